@@ -49,7 +49,7 @@
  *  local variables
  */
 
-#ifdef SPI_HARDWARE
+#if defined (SPI_HARDWARE) || defined (SPI_USART)
 /* SPI */
 uint8_t             ClockRate;     /* SPI clock rate bits */
 uint8_t             OldClockRate;  /* SPI clock rate bits */
@@ -91,7 +91,7 @@ void Touch_BusSetup(void)
    *  init SPI bus
    */
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /*
    *  set SPI clock rate (max. 2MHz)
    */
@@ -167,7 +167,7 @@ void Touch_SelectChip(void)
   /* select chip */
   TOUCH_PORT &= ~(1 << TOUCH_CS);       /* set /CS low */
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /* change SPI clock for touch controller */
   OldClockRate = SPI.ClockRate;         /* save old clock settings */
   SPI.ClockRate = ClockRate;            /* set new clock rate */
@@ -187,7 +187,7 @@ void Touch_DeselectChip(void)
   /* disable chip */
   TOUCH_PORT |= (1 << TOUCH_CS);        /* set /CS high */
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /* change SPI clock for display controller */
   SPI.ClockRate = OldClockRate;         /* set old clock rate */
   SPI_Clock();                          /* update SPI clock */
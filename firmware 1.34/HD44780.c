@@ -15,9 +15,11 @@
  *    DB6    LCD_DB6 (default: LCD_PORT Bit #2)
  *    DB7    LCD_DB7 (default: LCD_PORT Bit #3)
  *    RS     LCD_RS
- *    R/W    Gnd
+ *    R/W    LCD_RW (optional, Gnd otherwise)
  *    E      LCD_EN1
- *  - write only since R/W is hardwired to Gnd
+ *  - write only if R/W is hardwired to Gnd, fixed delays
+ *  - with LCD_RW the busy flag is read instead of waiting a fixed time,
+ *    requires LCD_PIN
  *  - max. clock for interface: 2 MHz
  *  - pin assignment for PCF8574 backpack
  *    DB4    LCD_DB4 (default: P4)
@@ -28,6 +30,9 @@
  *    R/W    LCD_RW  (default: P1)
  *    E      LCD_EN1 (default: P2)
  *    LED    LCD_LED (default: P3)
+ *  - PCF8574 updates its port pins after each byte received, so both
+ *    nibbles of a LCD byte including the Enable pulses are sent in a
+ *    single I2C transfer
  */
 
 
@@ -101,11 +106,72 @@ void LCD_BusSetup(void)
 
   LCD_DDR |= (1 << LCD_RS) | (1 << LCD_EN1) | (1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7);
 
+  #ifdef LCD_BUSY_FLAG
+  /* R/W line: low for write mode */
+  LCD_PORT &= ~(1 << LCD_RW);      /* set R/W low */
+  LCD_DDR |= (1 << LCD_RW);        /* output mode */
+  #endif
+
   /* LCD_EN1 should be low by default */
 }
 
 
 
+#ifdef LCD_BUSY_FLAG
+
+/*
+ *  wait until LCD is ready for next command or data byte
+ *  - reads busy flag (DB7) in 4 bit mode: two nibbles,
+ *    busy flag and address counter (upper nibble first)
+ *  - timeout after about 3ms (clear display takes 1.52ms)
+ */
+
+void LCD_WaitReady(void)
+{
+  uint8_t           Mask;          /* bitmask for data lines */
+  uint8_t           RS;            /* state of RS */
+  uint8_t           Busy;          /* busy flag */
+  uint8_t           n = 200;       /* timeout counter */
+
+  Mask = (1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7);
+
+  RS = LCD_PORT & (1 << LCD_RS);   /* save RS */
+
+  /* read instruction register */
+  LCD_DDR &= ~Mask;                /* data lines: input mode */
+  LCD_PORT &= ~(Mask | (1 << LCD_RS));  /* no pull-ups, set RS low */
+  LCD_PORT |= (1 << LCD_RW);       /* set R/W high */
+
+  while (n > 0)
+  {
+    /* upper nibble: busy flag and address counter */
+    LCD_PORT |= (1 << LCD_EN1);    /* set EN1 high */
+    _delay_us(1);                  /* data delay time: max. 360ns */
+    Busy = LCD_PIN & (1 << LCD_DB7);    /* get busy flag */
+    LCD_PORT &= ~(1 << LCD_EN1);   /* set EN1 low */
+    _delay_us(1);
+
+    /* lower nibble: address counter (ignore) */
+    LCD_PORT |= (1 << LCD_EN1);    /* set EN1 high */
+    _delay_us(1);
+    LCD_PORT &= ~(1 << LCD_EN1);   /* set EN1 low */
+
+    if (Busy == 0) break;          /* LCD is ready */
+
+    wait10us();                    /* wait a moment */
+    n--;                           /* and try again */
+  }
+
+  /* back to write mode */
+  LCD_PORT &= ~(1 << LCD_RW);      /* set R/W low */
+  LCD_DDR |= Mask;                 /* data lines: output mode */
+  LCD_PORT |= RS;                  /* restore RS */
+}
+
+#endif
+
+
+
 /*
  *  send a nibble to the LCD (4 bit mode)
  *
@@ -158,6 +224,10 @@ void LCD_Send(uint8_t Byte)
 {
   uint8_t           Nibble;
 
+  #ifdef LCD_BUSY_FLAG
+  LCD_WaitReady();       /* wait until LCD has processed last byte */
+  #endif
+
   /* send upper nibble (bits 4-7) */
   Nibble = (Byte >> 4) & 0x0F;          /* get upper nibble */
   LCD_SendNibble(Nibble);
@@ -166,7 +236,9 @@ void LCD_Send(uint8_t Byte)
   Nibble = Byte & 0x0F;                 /* get lower nibble */
   LCD_SendNibble(Nibble);
 
+  #ifndef LCD_BUSY_FLAG
   wait50us();            /* LCD needs some time for processing */
+  #endif
 
   /* clear data lines on port */  
   Nibble = ~((1 << LCD_DB4) | (1 << LCD_DB5) | (1 << LCD_DB6) | (1 << LCD_DB7));
@@ -213,6 +285,15 @@ void LCD_Char(unsigned char Char)
   ID = pgm_read_byte(Table);            /* get ID number */
   if (ID == 0xff) return;               /* no character available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_RS);       /* set RS high */
  
@@ -340,9 +421,14 @@ uint8_t             Control;       /* LCD's control lines */
 
 /*
  *  set PCF8574's port pins via I2C
+ *  - several bytes are output one after another
+ *
+ *  requires:
+ *  - Data: pointer to port pin states
+ *  - Count: number of states
  */
 
-void PCF8574_Write(uint8_t Byte)
+void PCF8574_Write(uint8_t *Data, uint8_t Count)
 {
   if (I2C_Start(I2C_START) == I2C_OK)             /* start */
   {
@@ -350,8 +436,7 @@ void PCF8574_Write(uint8_t Byte)
 
     if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)    /* address slave */
     {
-      I2C.Byte = Byte;                  /* port pins */
-      I2C_WriteByte(I2C_DATA);          /* send data */
+      I2C_WriteBlock(Data, Count);      /* port pins */
     }
     /* todo: error handling? */
   }
@@ -381,7 +466,7 @@ void LCD_BusSetup(void)
    */
 
   Control = (1 << LCD_LED);
-  PCF8574_Write(Control);
+  PCF8574_Write(&Control, 1);
 }
 
 
@@ -389,6 +474,8 @@ void LCD_BusSetup(void)
 /*
  *  write data into LCD
  *  - LCD needs an Enable pulse to take in data for processing
+ *  - a byte on the I2C bus takes at least 22s, which is long
+ *    enough for the Enable pulse (min. 450ns)
  *
  *  requires:
  *  - byte value to send (PCF8574's port)
@@ -396,27 +483,27 @@ void LCD_BusSetup(void)
 
 void LCD_Write(uint8_t Byte)
 {
-  Byte |= (1 << LCD_EN1);     /* set Enable bit */
-  PCF8574_Write(Byte);        /* update port pins */
+  uint8_t           Pins[2];       /* port pin states */
 
-  /* the LCD needs some time */
-  /* if required adjust time according to LCD's datasheet */
-  wait10us();
+  Pins[0] = Byte | (1 << LCD_EN1);      /* set Enable bit */
+  Pins[1] = Byte;                       /* clear Enable bit */
 
-  Byte &= ~(1 << LCD_EN1);    /* clear Enable bit */
-  PCF8574_Write(Byte);        /* update port pins */
+  PCF8574_Write(Pins, 2);          /* update port pins */
 }
 
 
 
 /*
- *  send a nibble to the LCD (4 bit mode)
+ *  get PCF8574's port pins for a nibble (4 bit mode)
  *
  *  requires:
- *  - nibble value to send
+ *  - nibble value
+ *
+ *  returns:
+ *  - port pins with current control lines
  */
 
-void LCD_SendNibble(uint8_t Nibble)
+uint8_t LCD_NibblePins(uint8_t Nibble)
 {
   uint8_t           Data;
 
@@ -434,7 +521,7 @@ void LCD_SendNibble(uint8_t Nibble)
     if (Nibble & 0b00001000) Data |= (1 << LCD_DB7);
   #endif
 
-  LCD_Write(Data);       /* write nibble */
+  return Data;
 }
 
 
@@ -449,33 +536,37 @@ void LCD_SendNibble(uint8_t Nibble)
 
 void LCD_Send(uint8_t Byte)
 {
-  uint8_t           Nibble;
+  uint8_t           Pins[5];       /* port pin states */
 
   wdt_reset();                /* reset watchdog */
 
   /*
-   *  send upper nibble (bits 4-7)
+   *  pack both nibbles into a single I2C transfer
+   *  - data with Enable set, then data with Enable cleared
    */
 
-  Nibble = (Byte >> 4) & 0x0F;          /* get upper nibble */
-  LCD_SendNibble(Nibble);
+  /* upper nibble (bits 4-7) */
+  Pins[1] = LCD_NibblePins((Byte >> 4) & 0x0F);
+  Pins[0] = Pins[1] | (1 << LCD_EN1);
 
+  /* lower nibble (bits 0-3) */
+  Pins[3] = LCD_NibblePins(Byte & 0x0F);
+  Pins[2] = Pins[3] | (1 << LCD_EN1);
 
-  /*
-   *  send lower nibble (bits 0-3)
-   */
-
-  Nibble = Byte & 0x0F;                 /* get lower nibble */
-  LCD_SendNibble(Nibble);
-
-  wait50us();            /* LCD needs some time for processing */
+  /* clear data lines on port */
+  Pins[4] = Control;
 
+  PCF8574_Write(Pins, 5);     /* update port pins */
 
   /*
-   *  clear data lines on port
-   */  
+   *  LCD needs 37s for processing
+   *  - in standard mode the next transfer's Start and address
+   *    take longer anyway
+   */
 
-  PCF8574_Write(Control);     /* update port pins */
+  #ifdef I2C_FAST_MODE
+  wait40us();
+  #endif
 }
 
 
@@ -518,6 +609,15 @@ void LCD_Char(unsigned char Char)
   ID = pgm_read_byte(Table);            /* get ID number */
   if (ID == 0xff) return;               /* no character available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* indicate data mode */
   Control |= (1 << LCD_RS);        /* set RS to 1 */
  
@@ -630,7 +730,13 @@ void LCD_CustomChar(uint8_t ID)
 void LCD_Clear(void)
 {
   LCD_Cmd(CMD_CLEAR_DISPLAY);      /* send clear command */
+  #ifndef LCD_BUSY_FLAG
   MilliSleep(2);                   /* LCD needs some time for processing */
+  #endif
+
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
 
   /* reset character position */
   UI.CharPos_X = 1;
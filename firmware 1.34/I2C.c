@@ -20,6 +20,10 @@
  *  - bus speed modes
  *    I2C_STANDARD_MODE  100kHz
  *    I2C_FAST_MODE      400kHz
+ *  - I2C_BLOCK enables I2C_WriteBlock() for long write sequences
+ *  - I2C_INTERRUPT adds interrupt driven transactions for hardware TWI
+ *    (I2C_Queue() and I2C_Wait()), the functions above wait until all
+ *    queued transactions are done
  *  - Don't forget the pull up resistors for SDA and SCL!
  *    Usually 2-10kOhms for 5V.
  */
@@ -424,6 +428,44 @@ uint8_t I2C_WriteByte(uint8_t Type)
 
 
 
+#ifdef I2C_BLOCK
+
+/*
+ *  write several data bytes (master to slave)
+ *  - long write sequence after addressing the slave
+ *  - stops at the first byte not acknowledged by the slave
+ *
+ *  requires:
+ *  - Data: pointer to data bytes (RAM)
+ *  - Count: number of bytes
+ *
+ *  returns:
+ *  - I2C_ERROR for bus error
+ *  - I2C_ACK for ACK
+ *  - I2C_NACK NACK
+ */
+
+uint8_t I2C_WriteBlock(uint8_t *Data, uint16_t Count)
+{
+  uint8_t           Flag = I2C_ACK;     /* return value */
+
+  while (Count > 0)           /* for all bytes */
+  {
+    I2C.Byte = *Data;                   /* copy byte */
+    Flag = I2C_WriteByte(I2C_DATA);     /* send byte */
+    if (Flag != I2C_ACK) break;         /* slave won't take more */
+
+    Data++;                   /* next byte */
+    Count--;
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
 #ifdef I2C_RW
 
 /*
@@ -655,6 +697,43 @@ void I2C_Stop(void)
 
 #ifdef I2C_HARDWARE
 
+#ifdef I2C_INTERRUPT
+
+/*
+ *  local constants
+ */
+
+/* queue */
+#define QUEUE_SIZE       8         /* max. number of transactions */
+
+/* phase of transaction */
+#define PHASE_HEAD       1         /* send header bytes */
+#define PHASE_TX         2         /* send data bytes */
+#define PHASE_RX         3         /* read data bytes */
+
+
+
+/*
+ *  local variables
+ */
+
+/* queue of transactions */
+I2C_Transaction_Type     *Queue[QUEUE_SIZE];     /* ring buffer */
+uint8_t                  QueueHead = 0;          /* current transaction */
+volatile uint8_t         QueueCount = 0;         /* queued transactions */
+
+/* state of current transaction */
+uint8_t                  Phase;         /* phase */
+uint8_t                  *DataPtr;      /* current byte */
+uint8_t                  DataCount;     /* remaining bytes */
+
+/* used by I2C_Start() */
+void I2C_Poll(void);
+
+#endif
+
+
+
 /*
  *  set up TWI
  *
@@ -672,17 +751,27 @@ uint8_t I2C_Setup(void)
    *  - SCL clock = MCU clock / (16 + 2*TWBR * prescaler)
    *  - available prescalers: 1, 4, 16 & 64
    *  - TWBR register: 1-255
+   *  - fast mode requires a MCU clock of at least 6.4MHz, otherwise
+   *    we run at the max. possible speed
    */
 
   /* set prescaler to 1 */
   TWSR = 0;           /* TWPS1=0 / TWPS0=0 */
 
-  #ifdef I2C_FAST_MODE
+  #if defined (I2C_FAST_MODE) && (CPU_FREQ >= 6400000)
     /* 400kHz */
-    TWBR = CPU_FREQ / 400000;
-  #else
+    TWBR = ((CPU_FREQ / 400000) - 16) / 2;
+  #elif ! defined (I2C_FAST_MODE) && (CPU_FREQ >= 1600000)
     /* 100kHz */
-    TWBR = CPU_FREQ / 100000;
+    TWBR = ((CPU_FREQ / 100000) - 16) / 2;
+  #else
+    /* max. speed for MCU clock */
+    TWBR = 0;
+  #endif
+
+  #if defined (I2C_INTERRUPT) && defined (SAVE_POWER)
+  /* we have to keep clk_IO running for background transactions */
+  Cfg.SleepMode = SLEEP_MODE_IDLE;      /* default sleep mode: power idle */
   #endif
 
   return Flag;
@@ -714,6 +803,15 @@ uint8_t I2C_Start(uint8_t Type)
    *  - Repeated Start after Start (no Stop yet)
    */
 
+  #ifdef I2C_INTERRUPT
+  if (Type == I2C_START)      /* new communication */
+  {
+    /* wait until queued transactions are done */
+    while (QueueCount > 0) I2C_Poll();
+    while (TWCR & (1 << TWSTO));        /* and Stop is done */
+  }
+  #endif
+
   /* set expected status flag */
   if (Type == I2C_START)      /* start */
   {
@@ -836,6 +934,70 @@ uint8_t I2C_WriteByte(uint8_t Type)
 
 
 
+#ifdef I2C_BLOCK
+
+/*
+ *  write several data bytes (master to slave)
+ *  - long write sequence after addressing the slave
+ *  - stops at the first byte not acknowledged by the slave
+ *  - status check is reduced to the expected status for data
+ *
+ *  requires:
+ *  - Data: pointer to data bytes (RAM)
+ *  - Count: number of bytes
+ *
+ *  returns:
+ *  - I2C_ERROR for bus error
+ *  - I2C_ACK for ACK
+ *  - I2C_NACK NACK
+ */
+
+uint8_t I2C_WriteBlock(uint8_t *Data, uint16_t Count)
+{
+  uint8_t           Flag = I2C_ACK;     /* return value */
+  uint8_t           Bits;               /* bits/bitmask */
+
+  while (Count > 0)           /* for all bytes */
+  {
+    /* load byte into data register */
+    TWDR = *Data;
+
+    /* send by clearing TWINT */
+    TWCR = (1 << TWINT) | (1 << TWEN);
+
+    /* wait for job done */
+    while (!(TWCR & (1 << TWINT)));     /* wait for flag */
+
+    /* check result */
+    Bits = TWSR;              /* get status */
+    /* filter status bits */
+    Bits &= (1 << TWS7) | (1 << TWS6) | (1 << TWS5) | (1 << TWS4) | (1 << TWS3);
+
+    if (Bits != ((1 << TWS5) | (1 << TWS3)))      /* not 0x28 data & ACK */
+    {
+      if (Bits == ((1 << TWS5) | (1 << TWS4)))    /* 0x30 data & NACK */
+      {
+        Flag = I2C_NACK;      /* signal NACK */
+      }
+      else                    /* 0x38 */
+      {
+        Flag = I2C_ERROR;     /* signal bus error */
+      }
+
+      break;                  /* slave won't take more */
+    }
+
+    Data++;                   /* next byte */
+    Count--;
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
 #ifdef I2C_RW
 
 /*
@@ -936,6 +1098,277 @@ void I2C_Stop(void)
 }
 
 
+
+#ifdef I2C_INTERRUPT
+
+/* ************************************************************************
+ *   interrupt driven transactions for hardware TWI
+ * ************************************************************************ */
+
+
+/*
+ *  A transaction (I2C_Transaction_Type) describes a complete
+ *  communication with a slave: Start, address, the header bytes and
+ *  data bytes to send, and optionally a Repeated Start and the bytes to
+ *  read. I2C_Queue() adds a transaction to the queue and returns at
+ *  once. The TWI ISR runs the transactions one after another and sets
+ *  the transaction's state to I2C_OK, I2C_NACK or I2C_ERROR when done.
+ *  The buffers have to stay valid until then. With interrupts disabled
+ *  (e.g. before the firmware's main loop) I2C_Poll() runs the state
+ *  machine instead of the ISR.
+ */
+
+
+/*
+ *  finish current transaction and start next one
+ *
+ *  requires:
+ *  - State: state of transaction
+ *    I2C_OK, I2C_NACK or I2C_ERROR
+ *
+ *  returns:
+ *  - value for TWCR
+ */
+
+uint8_t I2C_Done(uint8_t State)
+{
+  uint8_t           Control;       /* value for TWCR */
+
+  Queue[QueueHead]->State = State;      /* signal state */
+
+  /* remove transaction from queue */
+  QueueHead++;
+  if (QueueHead >= QUEUE_SIZE) QueueHead = 0;
+  QueueCount--;
+
+  /* stop and start next transaction if queued */
+  Control = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+  if (QueueCount > 0)              /* next transaction */
+  {
+    /* Stop followed by Start */
+    Control |= (1 << TWIE) | (1 << TWSTA);
+  }
+
+  return Control;
+}
+
+
+
+/*
+ *  state machine for transactions
+ *  - processes the TWI status of the current transaction
+ *  - called by the TWI ISR or I2C_Poll()
+ */
+
+void I2C_Step(void)
+{
+  I2C_Transaction_Type   *Job;     /* current transaction */
+  uint8_t           Status;        /* TWI status */
+  uint8_t           Control;       /* value for TWCR */
+
+  Job = Queue[QueueHead];          /* get current transaction */
+
+  /* default: continue with interrupt enabled */
+  Control = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+
+  Status = TWSR;              /* get status */
+  /* filter status bits */
+  Status &= (1 << TWS7) | (1 << TWS6) | (1 << TWS5) | (1 << TWS4) | (1 << TWS3);
+
+  switch (Status)
+  {
+    case 0x08:                /* Start */
+      /* begin with header */
+      Phase = PHASE_HEAD;
+      DataPtr = Job->Head;
+      DataCount = Job->HeadCount;
+
+      if ((Job->HeadCount == 0) && (Job->TX_Count == 0) && (Job->RX_Count > 0))
+      {
+        /* read only: SLA+R */
+        TWDR = (Job->Address << 1) | 0b00000001;
+      }
+      else
+      {
+        /* SLA+W */
+        TWDR = Job->Address << 1;
+      }
+      break;
+
+    case 0x10:                /* Repeated Start */
+      /* SLA+R */
+      TWDR = (Job->Address << 1) | 0b00000001;
+      break;
+
+    case 0x18:                /* SLA+W & ACK */
+    case 0x28:                /* data & ACK */
+      if ((DataCount == 0) && (Phase == PHASE_HEAD))
+      {
+        /* header done, continue with data */
+        Phase = PHASE_TX;
+        DataPtr = Job->TX_Data;
+        DataCount = Job->TX_Count;
+      }
+
+      if (DataCount > 0)           /* bytes left to send */
+      {
+        TWDR = *DataPtr;           /* send byte */
+        DataPtr++;                 /* next byte */
+        DataCount--;
+      }
+      else if (Job->RX_Count > 0)  /* bytes to read */
+      {
+        Control |= (1 << TWSTA);   /* Repeated Start */
+      }
+      else                         /* all done */
+      {
+        Control = I2C_Done(I2C_OK);
+      }
+      break;
+
+    case 0x40:                /* SLA+R & ACK */
+      Phase = PHASE_RX;
+      DataPtr = Job->RX_Data;
+      DataCount = Job->RX_Count;
+      /* ACK all bytes but the last one */
+      if (DataCount > 1) Control |= (1 << TWEA);
+      break;
+
+    case 0x50:                /* data read & ACK */
+      *DataPtr = TWDR;             /* save byte */
+      DataPtr++;                   /* next byte */
+      DataCount--;
+      if (DataCount > 1) Control |= (1 << TWEA);
+      break;
+
+    case 0x58:                /* data read & NACK (last byte) */
+      *DataPtr = TWDR;             /* save byte */
+      Control = I2C_Done(I2C_OK);
+      break;
+
+    case 0x20:                /* SLA+W & NACK */
+    case 0x30:                /* data & NACK */
+    case 0x48:                /* SLA+R & NACK */
+      Control = I2C_Done(I2C_NACK);
+      break;
+
+    default:                  /* bus error or arbitration lost */
+      Control = I2C_Done(I2C_ERROR);
+      break;
+  }
+
+  TWCR = Control;             /* next step */
+}
+
+
+
+/*
+ *  run state machine when interrupts are disabled
+ *  - to be called by wait loops
+ */
+
+void I2C_Poll(void)
+{
+  if (! (SREG & (1 << SREG_I)))    /* interrupts disabled */
+  {
+    if (TWCR & (1 << TWINT))       /* TWI waits for us */
+    {
+      I2C_Step();                  /* process status */
+    }
+  }
+}
+
+
+
+/*
+ *  queue transaction
+ *  - waits if queue is full
+ *  - starts transaction at once if there's no other one running
+ *
+ *  requires:
+ *  - Job: pointer to transaction
+ */
+
+void I2C_Queue(I2C_Transaction_Type *Job)
+{
+  uint8_t           Pos;           /* position in queue */
+  uint8_t           Flag;          /* status register */
+
+  /* wait for free slot */
+  while (QueueCount >= QUEUE_SIZE) I2C_Poll();
+
+  Job->State = I2C_BUSY;           /* not done yet */
+
+  Flag = SREG;                     /* save status */
+  cli();                           /* disable interrupts */
+
+  /* add transaction to queue */
+  Pos = QueueHead + QueueCount;
+  if (Pos >= QUEUE_SIZE) Pos -= QUEUE_SIZE;
+  Queue[Pos] = Job;
+  QueueCount++;
+
+  if (QueueCount == 1)             /* no transaction running */
+  {
+    while (TWCR & (1 << TWSTO));   /* wait for last Stop */
+
+    /* Start */
+    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWSTA);
+  }
+
+  SREG = Flag;                     /* restore status (and interrupts) */
+}
+
+
+
+/*
+ *  wait for transaction to be done
+ *
+ *  requires:
+ *  - Job: pointer to transaction
+ *
+ *  returns:
+ *  - I2C_OK on success
+ *  - I2C_NACK if slave didn't ACK
+ *  - I2C_ERROR on bus error
+ */
+
+uint8_t I2C_Wait(I2C_Transaction_Type *Job)
+{
+  while (Job->State == I2C_BUSY) I2C_Poll();
+
+  return Job->State;
+}
+
+
+
+/*
+ *  wait until all queued transactions are done
+ *  - barrier for timing sensitive stuff, e.g. probing
+ *    (TWI interrupts would interfere)
+ */
+
+void I2C_Flush(void)
+{
+  while (QueueCount > 0) I2C_Poll();
+}
+
+
+
+/*
+ *  ISR for TWI
+ *  - TWINT is set after each step of the TWI
+ *  - TWINT isn't cleared automatically
+ */
+
+ISR(TWI_vect, ISR_BLOCK)
+{
+  I2C_Step();                 /* process status */
+}
+
+#endif
+
+
 #endif
 
 
@@ -52,10 +52,18 @@
 /* fonts and symbols */
 /* horizontally aligned, horizontal bit order flipped */
 #include "font_8x8_hf.h"
-#include "font_12x16_hf.h"
-#include "font_16x26_hf.h"
 #include "symbols_24x24_hf.h"
-#include "symbols_32x32_hf.h"
+
+/* run-length encoded */
+#ifdef UI_BITMAP_RLE
+  #include "font_12x16_hf_rle.h"
+  #include "font_16x26_hf_rle.h"
+  #include "symbols_32x32_hf_rle.h"
+#else
+  #include "font_12x16_hf.h"
+  #include "font_16x26_hf.h"
+  #include "symbols_32x32_hf.h"
+#endif
 
 
 
@@ -103,6 +111,12 @@ uint16_t            X_End;         /* end position X (column) */
 uint16_t            Y_Start;       /* start position Y (page/row) */
 uint16_t            Y_End;         /* end position Y (page/row) */
 
+/* address window set in controller */
+uint16_t            Win_X_Start;   /* start position X */
+uint16_t            Win_X_End;     /* end position X */
+uint16_t            Win_Y_Start;   /* start position Y */
+uint16_t            Win_Y_End;     /* end position Y */
+
 /* text line management */
 uint16_t            LineMask;      /* bit mask for up to 16 lines */
 
@@ -156,7 +170,7 @@ void LCD_BusSetup(void)
   #endif
 
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /*
    *  set SPI clock rate (10MHz worst case)
    *  - max. MCU clock 20MHz / 2 = 10MHz
@@ -233,9 +247,41 @@ void LCD_Data(uint8_t Data)
  */
 
 void LCD_Data2(uint16_t Data)
+{
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/C high */
+
+  /* select chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT &= ~(1 << LCD_CS);    /* set /CS1 low */
+  #endif
+
+  SPI_Write_Word(Data);            /* write data */
+
+  /* deselect chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT |= (1 << LCD_CS);     /* set /CS1 high */
+  #endif
+}
+
+
+
+/*
+ *  send a run of pixels with the same color to the LCD
+ *  - keeps D/C and /CS asserted for the whole run
+ *  - black and white are sent as constant bit level
+ *
+ *  requires:
+ *  - Color: RGB565 color
+ *  - Count: number of pixels
+ */
+
+void LCD_Pixels(uint16_t Color, uint16_t Count)
 {
   uint8_t           Byte;     /* data byte */
 
+  if (Count == 0) return;          /* nothing to do */
+
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_DC);       /* set D/C high */
 
@@ -244,11 +290,21 @@ void LCD_Data2(uint16_t Data)
     LCD_PORT &= ~(1 << LCD_CS);    /* set /CS1 low */
   #endif
 
-  Byte = (uint8_t)Data;            /* save LSB */
-  Data >>= 8;                      /* get MSB */
+  Byte = (uint8_t)Color;           /* get LSB */
 
-  SPI_Write_Byte((uint8_t)Data);   /* write MSB of data */
-  SPI_Write_Byte(Byte);            /* write LSB of data */
+  if ((uint8_t)(Color >> 8) == Byte)    /* MSB and LSB are the same */
+  {
+    Count <<= 1;                   /* 2 bytes per pixel */
+    SPI_Write_Fill(Byte, Count);   /* stream bytes */
+  }
+  else                             /* different bytes */
+  {
+    while (Count > 0)              /* for all pixels */
+    {
+      SPI_Write_Word(Color);       /* write data */
+      Count--;                     /* next pixel */
+    }
+  }
 
   /* deselect chip, if pin available */
   #ifdef LCD_CS
@@ -269,19 +325,33 @@ void LCD_Data2(uint16_t Data)
 /*
  *  set address window
  *  - 0 up to (max - 1)
+ *  - sends only the coordinates which have changed, e.g. characters
+ *    in the same text line share the pages
  */
 
 void LCD_AddressWindow(void)
 {
   /* X -> column */
-  LCD_Cmd(CMD_COL_ADDR_SET);
-  LCD_Data2(X_Start);               /* start column */
-  LCD_Data2(X_End);                 /* end column */
+  if ((X_Start != Win_X_Start) || (X_End != Win_X_End))
+  {
+    LCD_Cmd(CMD_COL_ADDR_SET);
+    LCD_Data2(X_Start);             /* start column */
+    LCD_Data2(X_End);               /* end column */
+
+    Win_X_Start = X_Start;          /* update window */
+    Win_X_End = X_End;
+  }
 
   /* Y -> page */
-  LCD_Cmd(CMD_PAGE_ADDR_SET);
-  LCD_Data2(Y_Start);               /* start page */
-  LCD_Data2(Y_End);                 /* end page */
+  if ((Y_Start != Win_Y_Start) || (Y_End != Win_Y_End))
+  {
+    LCD_Cmd(CMD_PAGE_ADDR_SET);
+    LCD_Data2(Y_Start);             /* start page */
+    LCD_Data2(Y_End);               /* end page */
+
+    Win_Y_Start = Y_Start;          /* update window */
+    Win_Y_End = Y_End;
+  }
 }
 
 
@@ -347,6 +417,14 @@ void LCD_ClearLine(uint8_t Line)
     Pos = UI.CharPos_X;            /* get current character position */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, Pos) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
   /* have we to clear this line? */
   if (Line <= 16)                  /* prevent overflow */
   {
@@ -388,19 +466,9 @@ void LCD_ClearLine(uint8_t Line)
   /* send background color */
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
 
-  while (y > 0)                    /* character height (pages) */
-  {
-    x = X_Start;                   /* reset start position */
-    while (x < LCD_PIXELS_X)       /* all columns */
-    {
-      /* send background color */
-      LCD_Data2(COLOR_BACKGROUND);
-
-      x++;                         /* next column */
-    }
-
-    y--;                           /* next page */
-  }
+  x = LCD_PIXELS_X - X_Start;     /* pixels per row */
+  x *= y;                          /* pixels of all rows */
+  LCD_Pixels(COLOR_BACKGROUND, x); /* send run */
 }
 
 
@@ -422,6 +490,10 @@ void LCD_Clear(void)
     n++;                           /* next line */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
+
   LCD_CharPos(1, 1);          /* reset character position */
 }
 
@@ -531,6 +603,8 @@ void LCD_Init(void)
   LCD_Data(Bits);
 
   /* address window */
+  Win_X_Start = 0xffff;            /* force update */
+  Win_Y_Start = 0xffff;
   X_Start = 0;
   X_End = LCD_PIXELS_X - 1;
   Y_Start = 0;
@@ -561,7 +635,7 @@ void LCD_Init(void)
   LCD_CharPos(1, 1);            /* reset character position */
 
   /* For bit-bang SPI we don't clear the display now, because it's quite slow */
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
     LCD_Clear();
   #endif
 }
@@ -580,11 +654,21 @@ void LCD_Char(unsigned char Char)
   uint8_t           *Table;        /* pointer to table */
   uint8_t           Index;         /* font index */
   uint16_t          Offset;        /* address offset */
+  #ifdef FONT_RLE
+  uint16_t          Left;          /* pixels left */
+  #else
   uint8_t           Pixels;        /* pixels in y direction */
   uint8_t           x;             /* bitmap x byte counter */
   uint8_t           y = 1;         /* bitmap y byte counter */
+  uint16_t          Pixel;         /* color of pixel */
+  #endif
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  uint16_t          Color = COLOR_BACKGROUND;  /* color of pixel run */
+  uint16_t          Run = 0;       /* pixels in run */
+  #ifdef UI_GLYPH_CACHE
+  uint8_t           *Runs;         /* pointer to run list */
+  #endif
 
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
@@ -595,9 +679,22 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
+  #ifdef FONT_RLE
+  Offset = pgm_read_word(&FontIndex[Index]);  /* offset for character */
+  #else
   Offset = FONT_BYTES_N * Index;       /* offset for character */
+  #endif
   Table += Offset;                     /* address of character data */
 
   /* LCD's address window */
@@ -610,6 +707,71 @@ void LCD_Char(unsigned char Char)
   Offset = UI.PenColor;                /* get pen color */
   LCD_Cmd(CMD_MEM_WRITE);              /* start writing */
 
+  #ifdef UI_GLYPH_CACHE
+  /* send pixel runs from glyph cache */
+  Runs = Glyph_Find(Char);             /* look up character */
+  if (Runs)                            /* cache hit */
+  {
+    n = *Runs;                         /* number of runs */
+    while (n > 0)
+    {
+      Runs++;                          /* next run */
+      LCD_Pixels(Color, *Runs);        /* send run */
+
+      /* toggle color */
+      if (Color == COLOR_BACKGROUND) Color = Offset;
+      else Color = COLOR_BACKGROUND;
+
+      n--;                             /* next run */
+    }
+
+    UI.CharPos_X++;             /* update character position */
+    return;
+  }
+
+  Runs = Glyph_Add(Char);              /* new cache entry */
+  #endif
+
+  #ifdef FONT_RLE
+
+  /* decode pixel runs and send them to display */
+  Left = FONT_SIZE_X * FONT_SIZE_Y;    /* pixels of character */
+  Bits = 0;                            /* start with high nibble */
+
+  while (Left > 0)
+  {
+    if (Bits == 0)                     /* high nibble */
+    {
+      Index = pgm_read_byte(Table);    /* read byte */
+      Table++;                         /* address for next byte */
+      n = Index >> 4;                  /* get high nibble */
+    }
+    else                               /* low nibble */
+    {
+      n = Index & 0x0f;                /* get low nibble */
+    }
+    Bits ^= 1;                         /* toggle nibble */
+
+    Run += n;                          /* add pixels to run */
+    Left -= n;
+
+    if ((n < 15) || (Left == 0))       /* end of run or last pixel */
+    {
+      LCD_Pixels(Color, Run);          /* send run */
+      #ifdef UI_GLYPH_CACHE
+      Glyph_Run(Runs, Run);            /* and add it to cache */
+      #endif
+
+      /* toggle color */
+      if (Color == COLOR_BACKGROUND) Color = Offset;
+      else Color = COLOR_BACKGROUND;
+
+      Run = 0;                         /* start new run */
+    }
+  }
+
+  #else
+
   /* read character bitmap and send it to display */
   while (y <= FONT_BYTES_Y)
   {
@@ -632,13 +794,25 @@ void LCD_Char(unsigned char Char)
       {
         if (Index & 0b00000001)         /* bit set */
         {
-          LCD_Data2(Offset);            /* foreground color */
+          Pixel = Offset;               /* foreground color */
         }
         else                            /* bit unset */
         {
-          LCD_Data2(COLOR_BACKGROUND);  /* background color */
+          Pixel = COLOR_BACKGROUND;     /* background color */
         }
 
+        if (Pixel != Color)             /* color changes */
+        {
+          LCD_Pixels(Color, Run);       /* send run */
+          #ifdef UI_GLYPH_CACHE
+          Glyph_Run(Runs, Run);         /* and add it to cache */
+          #endif
+          Color = Pixel;                /* start new run */
+          Run = 0;
+        }
+
+        Run++;                          /* one more pixel */
+
         Index >>= 1;                      /* shift byte for next bit */
         n--;                              /* next bit */
       }
@@ -650,6 +824,13 @@ void LCD_Char(unsigned char Char)
     y++;                                /* next row */
   }
 
+  LCD_Pixels(Color, Run);               /* send last run */
+  #ifdef UI_GLYPH_CACHE
+  Glyph_Run(Runs, Run);                 /* and add it to cache */
+  #endif
+
+  #endif
+
   UI.CharPos_X++;             /* update character position */
 }
 
@@ -703,15 +884,32 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           Pixels;        /* pixels in y direction */
   uint8_t           x;             /* bitmap x byte counter */
   uint8_t           y = 1;         /* bitmap y byte counter */
+  #ifdef SYMBOL_RLE
+  uint8_t           Left;          /* pixels left in nibble */
+  uint8_t           State;         /* decoder state */
+  #else
   uint8_t           Bits;          /* number of bits to be sent */
+  #endif
   uint8_t           n;             /* bitmap bit counter */
   uint8_t           factor = SYMBOL_RESIZE;  /* resize factor */
+  uint16_t          Color = COLOR_BACKGROUND;  /* color of pixel run */
+  uint16_t          Run = 0;       /* pixels in run */
+  uint16_t          Pixel;         /* color of pixel */
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOL_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
+  #endif
   Table += Offset;                      /* address of symbol data */
 
+  #ifdef UI_TEXT_SHADOW
+  /* text shadow doesn't know the symbol */
+  Shadow_Invalidate(LCD_SYMBOL_CHAR_X, LCD_SYMBOL_CHAR_Y);
+  #endif
+
   /* LCD's address window */
   LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);   /* update character position */
                                              /* also updates X_Start and Y_Start */
@@ -722,6 +920,93 @@ void LCD_Symbol(uint8_t ID)
   Offset = UI.PenColor;                 /* get pen color */
   LCD_Cmd(CMD_MEM_WRITE);               /* start writing */
 
+  #ifdef SYMBOL_RLE
+
+  /*
+   *  decode pixel runs row by row
+   *  - the decoder state at the start of a row is saved to be able
+   *    to repeat the row for resizing
+   *  - x, y and Table2 keep the saved state
+   */
+
+  Left = 0;                        /* no pixels left */
+  State = 0;                       /* high nibble, background color */
+
+  while (y <= SYMBOL_SIZE_Y)
+  {
+    /* save decoder state */
+    Table2 = Table;
+    x = Left;
+    n = State;
+
+    while (factor > 0)        /* resize symbol */
+    {
+      /* restore decoder state */
+      Table = Table2;
+      Left = x;
+      State = n;
+
+      Pixels = SYMBOL_SIZE_X;      /* pixels to be sent for this row */
+
+      while (Pixels > 0)
+      {
+        while (Left == 0)          /* get next nibble */
+        {
+          if (State & RLE_TOGGLE)       /* last run has ended */
+          {
+            State ^= RLE_TOGGLE | RLE_FG;    /* clear flag and toggle color */
+          }
+
+          if (State & RLE_LOW)          /* low nibble */
+          {
+            Data = pgm_read_byte(Table - 1);      /* re-read byte */
+            Left = Data & 0x0f;         /* get low nibble */
+          }
+          else                          /* high nibble */
+          {
+            Data = pgm_read_byte(Table);    /* read byte */
+            Table++;                    /* address for next byte */
+            Left = Data >> 4;           /* get high nibble */
+          }
+          State ^= RLE_LOW;             /* toggle nibble */
+
+          if (Left < 15) State |= RLE_TOGGLE;     /* end of run */
+        }
+
+        /* part of nibble within this row */
+        Data = Left;
+        if (Data > Pixels) Data = Pixels;
+        Left -= Data;
+        Pixels -= Data;
+
+        if (State & RLE_FG)        /* foreground */
+        {
+          Pixel = Offset;          /* foreground color */
+        }
+        else                       /* background */
+        {
+          Pixel = COLOR_BACKGROUND;     /* background color */
+        }
+
+        if (Pixel != Color)        /* color changes */
+        {
+          LCD_Pixels(Color, Run);       /* send run */
+          Color = Pixel;                /* start new run */
+          Run = 0;
+        }
+
+        Run += Data * SYMBOL_RESIZE;    /* add pixels to run */
+      }
+
+      factor--;                    /* one part done */
+    }
+
+    factor = SYMBOL_RESIZE;        /* reset resize factor */
+    y++;                           /* next row */
+  }
+
+  #else
+
   /* read character bitmap and send it to display */
   while (y <= SYMBOL_BYTES_Y)
   {
@@ -752,13 +1037,22 @@ void LCD_Symbol(uint8_t ID)
         {
           if (Data & 0b00000001)             /* bit set */
           {
-            LCD_Data2(Offset);               /* foreground color */
+            Pixel = Offset;                  /* foreground color */
           }
           else                               /* bit unset */
           {
-            LCD_Data2(COLOR_BACKGROUND);     /* background color */
+            Pixel = COLOR_BACKGROUND;        /* background color */
+          }
+
+          if (Pixel != Color)                /* color changes */
+          {
+            LCD_Pixels(Color, Run);          /* send run */
+            Color = Pixel;                   /* start new run */
+            Run = 0;
           }
 
+          Run++;                             /* one more pixel */
+
           n--;                          /* next pixel */
 
           if (n % SYMBOL_RESIZE == 0)   /* for every resize step */
@@ -781,6 +1075,10 @@ void LCD_Symbol(uint8_t ID)
     }              
   }
 
+  #endif
+
+  LCD_Pixels(Color, Run);          /* send last run */
+
   /* mark text lines as used */
   n = LCD_SYMBOL_CHAR_Y;           /* set line counter */
   x = UI.SymbolPos_Y;              /* start line */
@@ -157,7 +157,7 @@ void LCD_BusSetup(void)
    *  init SPI bus
    */
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /*
    *  set SPI clock rate (max. 4MHz)
    */
@@ -225,6 +225,10 @@ void LCD_Cmd(uint8_t Cmd)
 
 void LCD_Data(uint8_t Data)
 {
+  #ifdef LCD_PAGE_SHADOW
+  if (Page_Data(Data)) return;     /* written to page shadow */
+  #endif
+
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_DC);                 /* set D/C high */
 
@@ -263,12 +267,41 @@ void LCD_Data(uint8_t Data)
 
 void LCD_DotPos(uint8_t x, uint8_t y)
 {
+  #ifdef LCD_PAGE_SHADOW
+  if (Page_Pos(x, y)) return;      /* position for page shadow */
+  #endif
+
   LCD_Cmd(CMD_ADDR_X | x);         /* set column */
   LCD_Cmd(CMD_ADDR_Y | y);         /* set bank */
 }
 
 
 
+#ifdef LCD_PAGE_SHADOW
+
+/*
+ *  send a block of data bytes to the LCD
+ *  - used by Page_Flush()
+ *
+ *  requires:
+ *  - Data: pointer to data bytes
+ *  - Count: number of bytes
+ */
+
+void LCD_DataBlock(uint8_t *Data, uint8_t Count)
+{
+  while (Count > 0)                /* for all bytes */
+  {
+    LCD_Data(*Data);               /* send byte */
+    Data++;                        /* next byte */
+    Count--;
+  }
+}
+
+#endif
+
+
+
 #ifndef LCD_ROT180
 
 /*
@@ -373,6 +406,14 @@ void LCD_ClearLine(uint8_t Line)
     n = UI.CharPos_X;         /* current character position */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, n) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
   LCD_CharPos(n, Line);       /* set char position */
 
   /* calculate banks */
@@ -394,6 +435,10 @@ void LCD_ClearLine(uint8_t Line)
 
     Line++;                   /* next bank */
   }
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 #endif
@@ -422,6 +467,14 @@ void LCD_ClearLine(uint8_t Line)
     n = UI.CharPos_X;         /* current character position */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, n) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
   LCD_CharPos(n, Line);            /* set char position */
   X_Start += FONT_SIZE_X;          /* offset for current char + 1 */
 
@@ -444,6 +497,10 @@ void LCD_ClearLine(uint8_t Line)
 
     Line++;                   /* next bank */
   }
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 #endif
@@ -463,7 +520,7 @@ void LCD_Clear(void)
 
   /* we have to clear all dots manually :-( */
 
-  LCD_CharPos(0, 0);          /* set start address */
+  LCD_DotPos(0, 0);           /* set start address */
 
   while (Bank < LCD_BANKS)         /* loop through all banks */
   {
@@ -478,7 +535,15 @@ void LCD_Clear(void)
     Bank++;                        /* next bank */           
   }
 
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
+
   LCD_CharPos(1, 1);          /* reset character position */
+
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
 }
 
 #endif
@@ -514,7 +579,15 @@ void LCD_Clear(void)
     }
   }
 
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
+
   LCD_CharPos(1, 1);          /* reset character position */
+
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
 }
 
 #endif
@@ -596,6 +669,10 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef LCD_PAGE_SHADOW
+  Page_Reset();               /* display content is unknown */
+  #endif
+
   LCD_Clear();                /* clear display to set char position */
 }
 
@@ -628,6 +705,15 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;         /* start address of font data */
   Offset = FONT_BYTES_N * Index;        /* offset for character */
@@ -657,6 +743,10 @@ void LCD_Char(unsigned char Char)
   /* update character position */
   UI.CharPos_X++;                  /* next character in current line */
   X_Start += FONT_SIZE_X;          /* also update X dot position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 #endif
@@ -691,6 +781,15 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;         /* start address of font data */
   Offset = FONT_BYTES_N * Index;        /* offset for character */
@@ -720,6 +819,10 @@ void LCD_Char(unsigned char Char)
   /* update character position */
   UI.CharPos_X++;                  /* next character in current line */
   X_Start -= FONT_SIZE_X;          /* also update X dot position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 #endif
@@ -776,6 +879,11 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y = 1;         /* bitmap y byte counter */
 
 
+  #ifdef UI_TEXT_SHADOW
+  /* text shadow doesn't know the symbol */
+  Shadow_Invalidate(LCD_SYMBOL_CHAR_X, LCD_SYMBOL_CHAR_Y);
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
@@ -803,6 +911,10 @@ void LCD_Symbol(uint8_t ID)
   }
 
   /* hint: we don't update the char position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 #endif
@@ -829,6 +941,11 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           y = 1;         /* bitmap y byte counter */
 
 
+  #ifdef UI_TEXT_SHADOW
+  /* text shadow doesn't know the symbol */
+  Shadow_Invalidate(LCD_SYMBOL_CHAR_X, LCD_SYMBOL_CHAR_Y);
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
@@ -859,6 +976,10 @@ void LCD_Symbol(uint8_t ID)
   }
 
   /* hint: we don't update the char position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 #endif
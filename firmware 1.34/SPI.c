@@ -1,6 +1,6 @@
 /* ************************************************************************
  *
- *   SPI (bit-bang & hardware)
+ *   SPI (bit-bang, hardware & USART)
  *
  *   (c) 2017-2018 by Markus Reschke
  *
@@ -18,6 +18,13 @@
  *  - For hardware SPI the MCU specific pins are used:
  *    ATmega 328: SCK / MOSI / MISO 
  *    ATmega 644: SCK PB7 / MOSI PB5 / MISO PB6
+ *  - For USART0 in master SPI mode (MSPIM) XCK is SCK, TxD is MOSI
+ *    and RxD is MISO:
+ *    ATmega 328: XCK PD4 / TxD PD1 / RxD PD0
+ *    ATmega 644: XCK PB0 / TxD PD1 / RxD PD0
+ *    port and pin for XCK
+ *    SPI_XCK_DDR   port data direction register
+ *    SPI_XCK       pin for XCK
  *  - /CS and other control signals have to be managed by the specific
  *    chip driver
  */
@@ -87,6 +94,9 @@ void SPI_Setup(void)
 
 
 
+/* unrolled assembler version in SPI_BB.S */
+#ifndef SPI_BITBANG_ASM
+
 /*
  *  write a single byte
  */
@@ -133,6 +143,95 @@ void SPI_Write_Byte(uint8_t Byte)
 
 
 
+#ifdef SPI_FILL
+
+/*
+ *  write the same byte several times
+ *  - for 0x00 and 0xff MOSI is set once and just SCK is toggled
+ *
+ *  requires:
+ *  - Byte: byte to send
+ *  - Count: number of bytes
+ */
+
+void SPI_Write_Fill(uint8_t Byte, uint16_t Count)
+{
+  uint8_t           n;             /* counter */
+
+  /* expected state: SCK low / MOSI undefined */
+
+  if ((Byte == 0x00) || (Byte == 0xff))      /* constant bit level */
+  {
+    /* set MOSI */
+    if (Byte)                 /* 1 */
+    {
+      /* set MOSI high */
+      SPI_PORT |= (1 << SPI_MOSI);
+    }
+    else                      /* 0 */
+    {
+      /* set MOSI low */
+      SPI_PORT &= ~(1 << SPI_MOSI);
+    }
+
+    while (Count > 0)         /* for all bytes */
+    {
+      n = 8;                  /* 8 bits */
+
+      while (n > 0)           /* for 8 bits */
+      {
+        /* clock cycle (rising edge takes bit) */
+        SPI_PORT |= (1 << SPI_SCK);
+        SPI_PORT &= ~(1 << SPI_SCK);
+
+        n--;                  /* next bit */
+      }
+
+      Count--;                /* next byte */
+    }
+  }
+  else                        /* mixed bits */
+  {
+    while (Count > 0)         /* for all bytes */
+    {
+      SPI_Write_Byte(Byte);   /* send byte */
+      Count--;                /* next byte */
+    }
+  }
+
+  /* current state: SCK low / MOSI undefined */
+}
+
+#endif
+
+#endif
+
+
+
+#ifdef SPI_WORD
+
+/*
+ *  write two bytes (MSB first)
+ *
+ *  requires:
+ *  - Word: 2-byte value to send
+ */
+
+void SPI_Write_Word(uint16_t Word)
+{
+  uint8_t           Byte;          /* data byte */
+
+  Byte = (uint8_t)Word;            /* save LSB */
+  Word >>= 8;                      /* get MSB */
+
+  SPI_Write_Byte((uint8_t)Word);   /* write MSB */
+  SPI_Write_Byte(Byte);            /* write LSB */
+}
+
+#endif
+
+
+
 #if SPI_RW
 
 /*
@@ -296,6 +395,58 @@ void SPI_Write_Byte(uint8_t Byte)
 
 
 
+#ifdef SPI_FILL
+
+/*
+ *  write the same byte several times
+ *  - writing SPDR after reading SPSR clears the flag too,
+ *    so we have to read SPDR only after the last byte
+ *
+ *  requires:
+ *  - Byte: byte to send
+ *  - Count: number of bytes
+ */
+
+void SPI_Write_Fill(uint8_t Byte, uint16_t Count)
+{
+  while (Count > 0)           /* for all bytes */
+  {
+    SPDR = Byte;                     /* start transmission */
+    while (!(SPSR & (1 << SPIF)));   /* wait for flag */
+    Count--;                         /* next byte */
+  }
+
+  Byte = SPDR;                     /* clear flag by reading data */
+}
+
+#endif
+
+
+
+#ifdef SPI_WORD
+
+/*
+ *  write two bytes (MSB first)
+ *
+ *  requires:
+ *  - Word: 2-byte value to send
+ */
+
+void SPI_Write_Word(uint16_t Word)
+{
+  uint8_t           Byte;          /* data byte */
+
+  Byte = (uint8_t)Word;            /* save LSB */
+  Word >>= 8;                      /* get MSB */
+
+  SPI_Write_Byte((uint8_t)Word);   /* write MSB */
+  SPI_Write_Byte(Byte);            /* write LSB */
+}
+
+#endif
+
+
+
 #if SPI_RW
 
 /*
@@ -321,6 +472,228 @@ uint8_t SPI_WriteRead_Byte(uint8_t Byte)
 #endif
 
 
+/* ************************************************************************
+ *   functions for USART in master SPI mode (MSPIM)
+ * ************************************************************************ */
+
+
+#ifdef SPI_USART
+
+/*
+ *  check for pins used otherwise
+ *  - USART takes over XCK, TxD and RxD (SPI_RW only)
+ *  - pins are compared by number, assuming the display and bit-bang
+ *    serial use the port of the USART pins (as in the examples)
+ */
+
+#ifdef SPI_RW
+  #define USART_PIN(x)   (((x) == SPI_XCK) || ((x) == SPI_TXD) || ((x) == SPI_RXD))
+#else
+  #define USART_PIN(x)   (((x) == SPI_XCK) || ((x) == SPI_TXD))
+#endif
+
+/* bit-bang serial */
+#ifdef SERIAL_BITBANG
+  #if USART_PIN(SERIAL_TX) || USART_PIN(SERIAL_RX)
+    #error <<< SPI_USART: pin used by bit-bang serial! >>>
+  #endif
+#endif
+
+/* control lines of display */
+#if (defined (LCD_RES) && USART_PIN(LCD_RES)) || \
+    (defined (LCD_RESET) && USART_PIN(LCD_RESET)) || \
+    (defined (LCD_CS) && USART_PIN(LCD_CS)) || \
+    (defined (LCD_SCE) && USART_PIN(LCD_SCE)) || \
+    (defined (LCD_DC) && USART_PIN(LCD_DC)) || \
+    (defined (LCD_A0) && USART_PIN(LCD_A0))
+  #error <<< SPI_USART: pin used by display! >>>
+#endif
+
+#undef USART_PIN
+
+
+
+/*
+ *  set SPI clock rate
+ *  - uses SPI.ClockRate for input (same flags as hardware SPI)
+ *  - f_SCK = f_MCU / (2 * (UBRR + 1))
+ */
+
+void SPI_Clock(void)
+{
+  uint8_t           Clock;    /* clock rate bits */
+  uint8_t           Div;      /* half of clock divider */
+
+  Clock = SPI.ClockRate;           /* get clock rate flags */
+
+  /* divider bits */
+  Div = 2;                         /* f_osc/4 */
+  if (Clock & SPI_CLOCK_R0) Div = 8;    /* f_osc/16 */
+  if (Clock & SPI_CLOCK_R1)
+  {
+    if (Div == 8) Div = 64;        /* f_osc/128 */
+    else Div = 32;                 /* f_osc/64 */
+  }
+
+  /* double SPI speed */
+  if (Clock & SPI_CLOCK_2X) Div >>= 1;
+
+  UBRR0 = Div - 1;                 /* set new clock rate */
+}
+
+
+
+/*
+ *  set up SPI bus
+ *  - clock and mode
+ *  - MOSI and MISO are set up automatically
+ */
+
+void SPI_Setup(void)
+{
+  uint8_t           Bits;     /* bits/bitmask */
+
+  /* set up bus only once */
+  if (Cfg.OP_Mode & OP_SPI) return;
+
+  /* clock rate has to be zero when enabling the transmitter */
+  UBRR0 = 0;
+
+  /* set XCK to output mode (selects master mode) */
+  /* using variable Bits to keep compiler happy */
+  Bits = SPI_XCK_DDR;
+  Bits |= (1 << SPI_XCK);
+  SPI_XCK_DDR = Bits;
+
+  /*
+   *  set up USART
+   *  - master SPI mode (UMSEL = 11)
+   *  - SPI mode 0 (UCPOL = 0, UCPHA = 0)
+   *  - MSB first (UDORD = 0)
+   */
+
+  UCSR0C = (1 << UMSEL01) | (1 << UMSEL00);
+
+  /* enable transmitter (and receiver) */
+  #ifdef SPI_RW
+    UCSR0B = (1 << RXEN0) | (1 << TXEN0);
+  #else
+    UCSR0B = (1 << TXEN0);
+  #endif
+
+  /* set clock rate */
+  SPI_Clock();
+
+  Cfg.OP_Mode |= OP_SPI;      /* bus is set up */
+}
+
+
+
+/*
+ *  write a single byte
+ */
+
+void SPI_Write_Byte(uint8_t Byte)
+{
+  /* send byte */
+  UCSR0A = (1 << TXC0);                 /* clear flag */
+  UDR0 = Byte;                          /* start transmission */
+  while (!(UCSR0A & (1 << TXC0)));      /* wait for flag */
+}
+
+
+
+#ifdef SPI_FILL
+
+/*
+ *  write the same byte several times
+ *  - the transmit buffer keeps the bus busy while we wait for the
+ *    next free slot
+ *
+ *  requires:
+ *  - Byte: byte to send
+ *  - Count: number of bytes
+ */
+
+void SPI_Write_Fill(uint8_t Byte, uint16_t Count)
+{
+  while (Count > 0)           /* for all bytes */
+  {
+    while (!(UCSR0A & (1 << UDRE0)));   /* wait for free buffer */
+    UCSR0A = (1 << TXC0);               /* clear flag */
+    UDR0 = Byte;                        /* buffer byte */
+    Count--;                            /* next byte */
+  }
+
+  /* wait until last byte is sent */
+  while (!(UCSR0A & (1 << TXC0)));
+}
+
+#endif
+
+
+
+#ifdef SPI_WORD
+
+/*
+ *  write two bytes (MSB first)
+ *  - the LSB goes to the transmit buffer while the MSB is clocked out
+ *
+ *  requires:
+ *  - Word: 2-byte value to send
+ */
+
+void SPI_Write_Word(uint16_t Word)
+{
+  uint8_t           Byte;          /* data byte */
+
+  Byte = (uint8_t)Word;            /* save LSB */
+  Word >>= 8;                      /* get MSB */
+
+  UCSR0A = (1 << TXC0);                 /* clear flag */
+  UDR0 = (uint8_t)Word;                 /* start transmission of MSB */
+  while (!(UCSR0A & (1 << UDRE0)));     /* wait for free buffer */
+  UCSR0A = (1 << TXC0);                 /* clear flag */
+  UDR0 = Byte;                          /* buffer LSB */
+  while (!(UCSR0A & (1 << TXC0)));      /* wait until both are sent */
+}
+
+#endif
+
+
+
+#ifdef SPI_RW
+
+/*
+ *  write and read a single byte
+ */
+
+uint8_t SPI_WriteRead_Byte(uint8_t Byte)
+{
+  uint8_t           Byte2;         /* return value */
+
+  /* flush receive buffer */
+  while (UCSR0A & (1 << RXC0))
+  {
+    Byte2 = UDR0;
+  }
+
+  /* send byte */
+  UCSR0A = (1 << TXC0);                 /* clear flag */
+  UDR0 = Byte;                          /* start transmission */
+  while (!(UCSR0A & (1 << RXC0)));      /* wait for received byte */
+
+  /* get received byte */
+  Byte2 = UDR0;
+
+  return Byte2;
+}
+
+#endif
+
+#endif
+
+
 
 /* ************************************************************************
  *   clean-up of local constants
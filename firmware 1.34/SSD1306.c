@@ -160,7 +160,7 @@ void LCD_BusSetup(void)
    *  init SPI bus
    */
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /*
    *  set SPI clock rate (max. 10MHz)
    *  - max. MCU clock 20MHz / 2 = 10MHz
@@ -211,6 +211,10 @@ void LCD_Cmd(uint8_t Cmd)
 
 void LCD_Data(uint8_t Data)
 {
+  #ifdef LCD_PAGE_SHADOW
+  if (Page_Data(Data)) return;     /* written to page shadow */
+  #endif
+
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_DC);       /* set D/C high */
 
@@ -243,10 +247,9 @@ void LCD_Data(uint8_t Data)
  */
 
 /* transfer mode */
-#define CTRL_CMD         0b00000001     /* command */
-#define CTRL_DATA        0b00000010     /* data */
-#define CTRL_SINGLE      0b00000100     /* single byte */
-#define CTRL_MULTI       0b00001000     /* multiple bytes */
+#define STREAM_NONE      0              /* no transfer */
+#define STREAM_CMD       1              /* commands, each with control byte */
+#define STREAM_DATA      2              /* data stream */
 
 
 
@@ -254,8 +257,18 @@ void LCD_Data(uint8_t Data)
  *  local variables
  */
 
-/* single/multi byte control */
-uint8_t             MultiByte;     /* control flag */
+/* transfer control */
+uint8_t             Stream;        /* current transfer mode */
+
+#if defined (LCD_PAGE_SHADOW) && defined (I2C_INTERRUPT)
+/* background transfers of page shadow, one per page */
+#define JOB_PAGES        (LCD_DOTS_Y / 8)    /* number of pages */
+#define JOB_HEAD         7                   /* header bytes */
+I2C_Transaction_Type     PageJob[JOB_PAGES];           /* transactions */
+uint8_t                  PageHead[JOB_PAGES][JOB_HEAD];  /* headers */
+uint8_t                  JobX;                         /* column */
+uint8_t                  JobY;                         /* page */
+#endif
 
 
 
@@ -269,71 +282,74 @@ void LCD_BusSetup(void)
   /* I2C is set up in main() already */
   I2C.Timeout = 1;            /* ACK timeout 10s */
 
-  /* init control flag */
-  MultiByte = 0;              /* single byte mode */
+  /* init transfer mode */
+  Stream = STREAM_NONE;       /* no transfer */
+}
+
+
+
+/*
+ *  end sending I2C data
+ *  - end running I2C transfer
+ *  - should be called at the end of each output function
+ */
+
+void LCD_EndTransfer(void)
+{
+  if (Stream != STREAM_NONE)       /* transfer is running */
+  {
+    I2C_Stop();                    /* stop */
+    Stream = STREAM_NONE;          /* no transfer */
+  }
 }
 
 
 
 /*
- *  start sending I2C data
- *  - set up I2C transfer
- *  - send control byte
- *  - manage single/multi byte mode
+ *  start or continue sending I2C data
+ *  - keeps a running transfer as long as possible:
+ *    commands are sent with a control byte each (continuation flag
+ *    set), so they can be followed by data in the same transfer
+ *  - a data stream (continuation flag cleared) can't take any
+ *    commands, so it's ended when a command is needed
  *
  *  requires:
  *  - Mode:
- *    CTRL_CMD     command
- *    CTRL_DATA    data
- *    CTRL_SINGLE  single byte
- *    CTRL_MULTI   multiple bytes
+ *    STREAM_CMD   command
+ *    STREAM_DATA  data
  */
 
 void LCD_StartTransfer(uint8_t Mode)
 {
-  uint8_t           Byte;          /* control byte */
+  if (Stream == Mode) return;      /* running already */
 
-  /* update control flag */
-  if (Mode & CTRL_MULTI)           /* multi byte mode */
+  if (Stream == STREAM_DATA)       /* data stream but command needed */
   {
-    MultiByte = 1;                 /* set flag */
+    LCD_EndTransfer();             /* end transfer */
   }
 
-  /* init control byte */
-  Byte = LCD_CONTROL_BYTE;
-  if (Mode & CTRL_SINGLE) Byte |= FLAG_CTRL_SINGLE;    /* single byte mode */
-  if (Mode & CTRL_DATA) Byte |= FLAG_CTRL_DATA;        /* data mode */
-  /* flags for multi byte mode and command mode are 0 */
-
-  if (I2C_Start(I2C_START) == I2C_OK)             /* start */
+  if (Stream == STREAM_NONE)       /* no transfer */
   {
-    I2C.Byte = LCD_I2C_ADDR << 1;       /* address (7 bit & write) */
-
-    if (I2C_WriteByte(I2C_ADDRESS) == I2C_ACK)    /* address slave */
+    /* start transfer and address slave */
+    if (I2C_Start(I2C_START) == I2C_OK)           /* start */
     {
-      I2C.Byte = Byte;                  /* copy control byte */
-      I2C_WriteByte(I2C_DATA);          /* send byte */
+      I2C.Byte = LCD_I2C_ADDR << 1;     /* address (7 bit & write) */
+      I2C_WriteByte(I2C_ADDRESS);       /* address slave */
     }
-  }
-
-  /* todo: error handling? */
-}
 
+    /* todo: error handling? */
 
+    Stream = STREAM_CMD;           /* ready for commands */
+  }
 
-/*
- *  end sending I2C data
- *  - end I2C transfer
- *  - manage multi byte mode
- */
-
-void LCD_EndTransfer(void)
-{
-  /* reset control flag anyway */
-  MultiByte = 0;              /* single byte mode */
+  if (Mode == STREAM_DATA)         /* switch to data stream */
+  {
+    /* control byte: stream of data bytes follows */
+    I2C.Byte = LCD_CONTROL_BYTE | FLAG_CTRL_MULTI | FLAG_CTRL_DATA;
+    I2C_WriteByte(I2C_DATA);       /* send control byte */
 
-  /* end I2C transfer */
-  I2C_Stop();                 /* stop */
+    Stream = STREAM_DATA;          /* data stream */
+  }
 }
 
 
@@ -347,20 +363,15 @@ void LCD_EndTransfer(void)
  
 void LCD_Cmd(uint8_t Cmd)
 {
-  if (MultiByte == 0)         /* single byte mode */
-  {
-    /* init transfer */
-    LCD_StartTransfer(CTRL_SINGLE | CTRL_CMD);
-  }
+  LCD_StartTransfer(STREAM_CMD);   /* start or continue transfer */
+
+  /* control byte: single command byte follows */
+  I2C.Byte = LCD_CONTROL_BYTE | FLAG_CTRL_SINGLE | FLAG_CTRL_CMD;
+  I2C_WriteByte(I2C_DATA);         /* send control byte */
 
   /* send command */
   I2C.Byte = Cmd;                  /* copy command */
   I2C_WriteByte(I2C_DATA);         /* send command */ 
-
-  if (MultiByte == 0)         /* single byte mode */
-  {
-    LCD_EndTransfer();             /* end transfer */
-  }
 }
 
 
@@ -374,20 +385,15 @@ void LCD_Cmd(uint8_t Cmd)
 
 void LCD_Data(uint8_t Data)
 {
-  if (MultiByte == 0)         /* single byte mode */
-  {
-    /* init transfer */
-    LCD_StartTransfer(CTRL_SINGLE | CTRL_DATA);
-  }
+  #ifdef LCD_PAGE_SHADOW
+  if (Page_Data(Data)) return;     /* written to page shadow */
+  #endif
 
-  /* send command */
+  LCD_StartTransfer(STREAM_DATA);  /* start or continue data stream */
+
+  /* send data */
   I2C.Byte = Data;                 /* copy data */
   I2C_WriteByte(I2C_DATA);         /* send data */ 
-
-  if (MultiByte == 0)         /* single byte mode */
-  {
-    LCD_EndTransfer();             /* end transfer */
-  }
 }
 
 #endif
@@ -414,9 +420,15 @@ void LCD_DotPos(uint8_t x, uint8_t y)
 {
   uint8_t           Temp;     /* temp. value */
 
-  #ifdef LCD_I2C
-  /* init transfer */
-  LCD_StartTransfer(CTRL_MULTI | CTRL_CMD);
+  #ifdef LCD_PAGE_SHADOW
+  if (Page_Pos(x, y)) return;      /* position for page shadow */
+  #endif
+
+  #if defined (LCD_I2C) && defined (LCD_PAGE_SHADOW) && defined (I2C_INTERRUPT)
+  /* position is sent along with the data by LCD_DataBlock() */
+  JobX = x;
+  JobY = y;
+  return;
   #endif
 
   /* horizontal position (column) */
@@ -430,12 +442,75 @@ void LCD_DotPos(uint8_t x, uint8_t y)
 
   /* vertical position (page) */
   LCD_Cmd(CMD_START_PAGE | y);     /* set page */
+}
 
-  #ifdef LCD_I2C
-  LCD_EndTransfer();               /* end transfer */
+
+
+#ifdef LCD_PAGE_SHADOW
+
+/*
+ *  send a block of data bytes to the LCD
+ *  - used by Page_Flush()
+ *
+ *  requires:
+ *  - Data: pointer to data bytes
+ *  - Count: number of bytes
+ */
+
+void LCD_DataBlock(uint8_t *Data, uint8_t Count)
+{
+  #if defined (LCD_I2C) && defined (I2C_INTERRUPT)
+  I2C_Transaction_Type   *Job;     /* transaction */
+  uint8_t                *Head;    /* header bytes */
+
+  /*
+   *  send position and data in the background
+   *  - header: three commands with a control byte each, then
+   *    the control byte for the data stream
+   *  - the shadow's page may change while it's sent, but the
+   *    changed bytes are dirty again and sent with the next flush
+   */
+
+  Job = &PageJob[JobY];
+  Head = &PageHead[JobY][0];
+
+  I2C_Wait(Job);              /* wait for last transfer of this page */
+
+  /* position */
+  Head[0] = LCD_CONTROL_BYTE | FLAG_CTRL_SINGLE | FLAG_CTRL_CMD;
+  Head[1] = CMD_COLUMN_L | (JobX & 0b00001111);   /* lower nibble */
+  Head[2] = LCD_CONTROL_BYTE | FLAG_CTRL_SINGLE | FLAG_CTRL_CMD;
+  Head[3] = CMD_COLUMN_H | (JobX >> 4);           /* upper nibble */
+  Head[4] = LCD_CONTROL_BYTE | FLAG_CTRL_SINGLE | FLAG_CTRL_CMD;
+  Head[5] = CMD_START_PAGE | JobY;                /* page */
+
+  /* data stream */
+  Head[6] = LCD_CONTROL_BYTE | FLAG_CTRL_MULTI | FLAG_CTRL_DATA;
+
+  /* set up transaction */
+  Job->Address = LCD_I2C_ADDR;
+  Job->Head = Head;
+  Job->HeadCount = JOB_HEAD;
+  Job->TX_Data = Data;
+  Job->TX_Count = Count;
+  Job->RX_Count = 0;
+
+  I2C_Queue(Job);             /* and run it */
+  #elif defined (LCD_I2C)
+  LCD_StartTransfer(STREAM_DATA);  /* start or continue data stream */
+  I2C_WriteBlock(Data, Count);     /* send bytes */
+  #else
+  while (Count > 0)                /* for all bytes */
+  {
+    LCD_Data(*Data);               /* send byte */
+    Data++;                        /* next byte */
+    Count--;
+  }
   #endif
 }
 
+#endif
+
 
 
 /*
@@ -468,6 +543,10 @@ void LCD_CharPos(uint8_t x, uint8_t y)
   Y_Start = y;                     /* update start position */
 
   LCD_DotPos(x, y);                /* set dot position */
+
+  #ifdef LCD_I2C
+  LCD_EndTransfer();               /* end transfer */
+  #endif
 }
 
 
@@ -491,6 +570,14 @@ void LCD_ClearLine(uint8_t Line)
     n = UI.CharPos_X;         /* get current character position */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, n) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
   LCD_CharPos(n, Line);       /* set char position */
 
   /* calculate pages */
@@ -502,11 +589,6 @@ void LCD_ClearLine(uint8_t Line)
   {
     LCD_DotPos(X_Start, Line);     /* set dot position */
 
-    #ifdef LCD_I2C
-    /* init transfer */
-    LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
-    #endif
-
     /* clear page */
     n = X_Start;              /* reset counter */
     while (n < 128)           /* for all columns */
@@ -515,12 +597,16 @@ void LCD_ClearLine(uint8_t Line)
       n++;                    /* next byte */
     }
 
-    #ifdef LCD_I2C
-    LCD_EndTransfer();        /* end transfer */
-    #endif
-
     Line++;                   /* next page */
   }
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
+
+  #ifdef LCD_I2C
+  LCD_EndTransfer();               /* end transfer */
+  #endif
 }
 
 
@@ -540,6 +626,10 @@ void LCD_Clear(void)
     n++;                           /* next line */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
+
   LCD_CharPos(1, 1);          /* reset character position */
 }
 
@@ -557,6 +647,10 @@ void LCD_Contrast(uint8_t Contrast)
   LCD_Cmd(CMD_CONTRAST);           /* set command */
   LCD_Cmd(Contrast);               /* contrast value */
 
+  #ifdef LCD_I2C
+  LCD_EndTransfer();               /* end transfer */
+  #endif
+
   NV.Contrast = Contrast;          /* update value */
 }
 
@@ -596,6 +690,10 @@ void LCD_Init(void)
   /* switch display on */
   LCD_Cmd(CMD_DISPLAY | FLAG_DISPLAY_ON);
 
+  #ifdef LCD_I2C
+  LCD_EndTransfer();               /* end transfer */
+  #endif
+
   /* dispays needs about 100ms */
 
   /* update maximums */
@@ -603,6 +701,10 @@ void LCD_Init(void)
   UI.CharMax_Y = LCD_CHAR_Y;       /* lines */
   UI.MaxContrast = 255;            /* LCD contrast */
 
+  #ifdef LCD_PAGE_SHADOW
+  Page_Reset();               /* display content is unknown */
+  #endif
+
   LCD_Clear();                /* clear display */
 }
 
@@ -633,6 +735,15 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
   Offset = FONT_BYTES_N * Index;       /* offset for character */
@@ -645,11 +756,6 @@ void LCD_Char(unsigned char Char)
   {
     LCD_DotPos(X_Start, Page);          /* set start position */
 
-    #ifdef LCD_I2C
-    /* init transfer */
-    LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
-    #endif
-
     /* read and send all column bytes for this row */
     x = 1;
     while (x <= FONT_BYTES_X)
@@ -660,10 +766,6 @@ void LCD_Char(unsigned char Char)
       x++;                              /* next byte */
     }
 
-    #ifdef LCD_I2C
-    LCD_EndTransfer();        /* end transfer */
-    #endif
-
     Page++;                             /* next page */
     y++;                                /* next row */
   }
@@ -671,6 +773,14 @@ void LCD_Char(unsigned char Char)
   /* update character position */
   UI.CharPos_X++;                  /* next character in current line */
   X_Start += FONT_SIZE_X;          /* also update X dot position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
+
+  #ifdef LCD_I2C
+  LCD_EndTransfer();               /* end transfer */
+  #endif
 }
 
 
@@ -723,6 +833,11 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           x;             /* bitmap x byte counter */
   uint8_t           y = 1;         /* bitmap y byte counter */
 
+  #ifdef UI_TEXT_SHADOW
+  /* text shadow doesn't know the symbol */
+  Shadow_Invalidate(LCD_SYMBOL_CHAR_X, LCD_SYMBOL_CHAR_Y);
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
@@ -738,11 +853,6 @@ void LCD_Symbol(uint8_t ID)
       LCD_DotPos(X_Start, Page);        /* move to new page */
     }
 
-    #ifdef LCD_I2C
-    /* init transfer */
-    LCD_StartTransfer(CTRL_MULTI | CTRL_DATA);
-    #endif
-
     /* read and send all column bytes for this row */
     x = 1;
     while (x <= SYMBOL_BYTES_X)
@@ -753,15 +863,19 @@ void LCD_Symbol(uint8_t ID)
       x++;                              /* next byte */
     }
 
-    #ifdef LCD_I2C
-    LCD_EndTransfer();        /* end transfer */
-    #endif
-
     Page++;                             /* next page */
     y++;                                /* next row */
   }
 
   /* hint: we don't update the char position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
+
+  #ifdef LCD_I2C
+  LCD_EndTransfer();               /* end transfer */
+  #endif
 }
 
 #endif
@@ -147,7 +147,7 @@ void LCD_BusSetup(void)
    *  init SPI bus
    */
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /*
    *  set SPI clock rate (max. 20MHz)
    *  - max. MCU clock 20MHz / 2 = 10MHz
@@ -198,6 +198,10 @@ void LCD_Cmd(uint8_t Cmd)
 
 void LCD_Data(uint8_t Data)
 {
+  #ifdef LCD_PAGE_SHADOW
+  if (Page_Data(Data)) return;     /* written to page shadow */
+  #endif
+
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_A0);       /* set A0 high */
 
@@ -238,6 +242,10 @@ void LCD_DotPos(uint8_t x, uint8_t y)
 {
   uint8_t           Temp;     /* temp. value */
 
+  #ifdef LCD_PAGE_SHADOW
+  if (Page_Pos(x, y)) return;      /* position for page shadow */
+  #endif
+
   /* horizontal position (column) */
   Temp = x;
   Temp &= 0b00001111;              /* filter lower nibble */
@@ -253,6 +261,31 @@ void LCD_DotPos(uint8_t x, uint8_t y)
 
 
 
+#ifdef LCD_PAGE_SHADOW
+
+/*
+ *  send a block of data bytes to the LCD
+ *  - used by Page_Flush()
+ *
+ *  requires:
+ *  - Data: pointer to data bytes
+ *  - Count: number of bytes
+ */
+
+void LCD_DataBlock(uint8_t *Data, uint8_t Count)
+{
+  while (Count > 0)                /* for all bytes */
+  {
+    LCD_Data(*Data);               /* send byte */
+    Data++;                        /* next byte */
+    Count--;
+  }
+}
+
+#endif
+
+
+
 /*
  *  set LCD character position
  *  - since we can't read the LCD and don't use a RAM buffer
@@ -309,6 +342,14 @@ void LCD_ClearLine(uint8_t Line)
     n = UI.CharPos_X;         /* get current character position */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, n) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
   LCD_CharPos(n, Line);       /* set char position */
 
   /* calculate pages */
@@ -330,6 +371,10 @@ void LCD_ClearLine(uint8_t Line)
 
     Line++;                   /* next page */
   }
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 
@@ -349,6 +394,10 @@ void LCD_Clear(void)
     n++;                           /* next line */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
+
   LCD_CharPos(1, 1);          /* reset character position */
 }
 
@@ -438,6 +487,10 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef LCD_PAGE_SHADOW
+  Page_Reset();               /* display content is unknown */
+  #endif
+
   LCD_Clear();                /* clear display */
 }
 
@@ -468,6 +521,15 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table);         /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
   Offset = FONT_BYTES_N * Index;       /* offset for character */
@@ -497,6 +559,10 @@ void LCD_Char(unsigned char Char)
   /* update character position */
   UI.CharPos_X++;                  /* next character in current line */
   X_Start += FONT_SIZE_X;          /* also update X dot position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 
@@ -549,6 +615,11 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           x;             /* bitmap x byte counter */
   uint8_t           y = 1;         /* bitmap y byte counter */
 
+  #ifdef UI_TEXT_SHADOW
+  /* text shadow doesn't know the symbol */
+  Shadow_Invalidate(LCD_SYMBOL_CHAR_X, LCD_SYMBOL_CHAR_Y);
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
@@ -579,6 +650,10 @@ void LCD_Symbol(uint8_t ID)
   }
 
   /* hint: we don't update the char position */
+
+  #ifdef LCD_PAGE_SHADOW
+  Page_Flush();                    /* send changes */
+  #endif
 }
 
 #endif
@@ -67,7 +67,8 @@
 /*
  *  fonts and symbols
  *  - Because of the horizontal addressing we're stuck with 8 pixels in x
- *    direction for the font. And we don't want to use a pixel screen buffer.
+ *    direction for the font. And we don't want to use a pixel screen buffer,
+ *    unless the GDRAM shadow is enabled (LCD_GDRAM_SHADOW).
  */
 
 #ifndef LCD_ROT180
@@ -90,6 +91,11 @@
 /* number of 16 bit steps for x direction */
 #define LCD_STEPS_X      (LCD_DOTS_X / 16)
 
+/* GDRAM shadow: bytes per row (font is 8 dots wide, one byte per char) */
+#ifdef LCD_GDRAM_SHADOW
+  #define GDRAM_BYTES_X  (LCD_DOTS_X / 8)
+#endif
+
 /* number of lines and characters per line */
 #define LCD_CHAR_X       (LCD_DOTS_X / FONT_SIZE_X)
 #define LCD_CHAR_Y       (LCD_DOTS_Y / FONT_SIZE_Y)
@@ -115,8 +121,19 @@
  *  local variables
  */
 
+#ifndef LCD_GDRAM_SHADOW
 /* character matrix (copy of screen, horizontally aligned) */
 unsigned char       Matrix[LCD_CHAR_X * LCD_CHAR_Y];   /* char matrix */
+#endif
+
+#ifdef LCD_GDRAM_SHADOW
+/* GDRAM shadow: copy of graphics RAM */
+uint8_t             GdramBuffer[LCD_DOTS_Y][GDRAM_BYTES_X];
+uint8_t             GdramDirty[LCD_DOTS_Y];      /* dirty 16 bit steps */
+uint8_t             GdramX = 0;                  /* write position: byte */
+uint8_t             GdramY = 0;                  /* write position: row */
+uint8_t             GdramMode = 0;               /* 1 = sending */
+#endif
 
 /* position management */
 uint8_t             X_Start;       /* start position X (column in 16 bit steps) */
@@ -130,6 +147,12 @@ uint8_t             Y_Start;       /* start position Y (row) */
 
 void LCD_Char(unsigned char Char);
 
+#ifdef LCD_GDRAM_SHADOW
+void LCD_DotPos(uint8_t x, uint8_t y);
+uint8_t GDRAM_Pos(uint8_t x, uint8_t y);
+uint8_t GDRAM_Data(uint8_t Byte);
+#endif
+
 
 
 /* ************************************************************************
@@ -279,6 +302,10 @@ void LCD_Cmd(uint8_t Byte)
 
 void LCD_Data(uint8_t Byte)
 {
+  #ifdef LCD_GDRAM_SHADOW
+  if (GDRAM_Data(Byte)) return;    /* written to GDRAM shadow */
+  #endif
+
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_RS);       /* set RS high */
 
@@ -342,7 +369,7 @@ void LCD_BusSetup(void)
    *  init SPI bus
    */
 
-  #ifdef SPI_HARDWARE
+  #if defined (SPI_HARDWARE) || defined (SPI_USART)
   /*
    *  set SPI clock rate (max. 2.5MHz)
    */
@@ -438,6 +465,10 @@ void LCD_Data(uint8_t Byte)
 {
   uint8_t           Start;
 
+  #ifdef LCD_GDRAM_SHADOW
+  if (GDRAM_Data(Byte)) return;    /* written to GDRAM shadow */
+  #endif
+
   #ifdef LCD_CS
     /* select chip */
     LCD_PORT |= (1 << LCD_CS);     /* set CS high */
@@ -462,6 +493,179 @@ void LCD_Data(uint8_t Byte)
 
 
 
+/* ************************************************************************
+ *   GDRAM shadow
+ * ************************************************************************ */
+
+
+#ifdef LCD_GDRAM_SHADOW
+
+/*
+ *  The ST7920 packs 16 dots into each GDRAM word, so without a copy of
+ *  the GDRAM LCD_Char() has to merge a character with its neighbor. The
+ *  GDRAM shadow is a RAM copy of the graphics RAM. LCD_Char() and
+ *  LCD_ClearLine() write directly to the shadow, and LCD_DotPos() and
+ *  LCD_Data() are redirected to it. Only 16 bit steps which actually
+ *  change are marked as dirty, and GDRAM_Flush() sends them row by row.
+ *  The output functions call it at their end, so the display is always
+ *  up to date.
+ */
+
+
+/*
+ *  mark all rows as dirty
+ *  - GDRAM content is unknown after reset
+ */
+
+void GDRAM_Reset(void)
+{
+  uint8_t           n = 0;         /* counter */
+
+  while (n < LCD_DOTS_Y)           /* for all rows */
+  {
+    GdramDirty[n] = 0xff;          /* all 16 bit steps */
+    n++;                           /* next row */
+  }
+}
+
+
+
+/*
+ *  write byte to GDRAM shadow
+ *
+ *  requires:
+ *  - x: byte column (0-)
+ *  - y: row (0-)
+ *  - Byte: data byte
+ */
+
+void GDRAM_Write(uint8_t x, uint8_t y, uint8_t Byte)
+{
+  uint8_t           *Data;         /* pointer to shadow */
+
+  if ((x < GDRAM_BYTES_X) && (y < LCD_DOTS_Y))
+  {
+    Data = &GdramBuffer[y][x];
+
+    if (*Data != Byte)             /* byte changes */
+    {
+      *Data = Byte;                /* update shadow */
+      GdramDirty[y] |= (1 << (x / 2));  /* mark 16 bit step as dirty */
+    }
+  }
+}
+
+
+
+/*
+ *  set write position
+ *
+ *  requires:
+ *  - x: horizontal position (16 bit steps, 0-)
+ *  - y: vertical position (row, 0-)
+ *
+ *  returns:
+ *  - 1 if buffered
+ *  - 0 if sending (driver has to set position)
+ */
+
+uint8_t GDRAM_Pos(uint8_t x, uint8_t y)
+{
+  if (GdramMode) return 0;         /* sent by GDRAM_Flush() */
+
+  GdramX = x * 2;                  /* convert 16 bit step into byte */
+  GdramY = y;
+
+  return 1;
+}
+
+
+
+/*
+ *  write data byte to GDRAM shadow
+ *  - moves to next byte, stays in current row
+ *
+ *  requires:
+ *  - Byte: data byte
+ *
+ *  returns:
+ *  - 1 if buffered
+ *  - 0 if sending (driver has to send byte)
+ */
+
+uint8_t GDRAM_Data(uint8_t Byte)
+{
+  if (GdramMode) return 0;         /* sent by GDRAM_Flush() */
+
+  GDRAM_Write(GdramX, GdramY, Byte);
+
+  GdramX++;                        /* next byte */
+  if (GdramX >= GDRAM_BYTES_X) GdramX = 0;    /* wrap around */
+
+  return 1;
+}
+
+
+
+/*
+ *  send dirty 16 bit steps of all rows to the display
+ *  - a single clean step between two dirty ones is sent too, since
+ *    two data bytes are faster than setting the GDRAM address again
+ */
+
+void GDRAM_Flush(void)
+{
+  uint8_t           Row = 0;       /* row counter */
+  uint8_t           Bits;          /* dirty 16 bit steps */
+  uint8_t           Step;          /* 16 bit step */
+  uint8_t           Next;          /* step of display's address counter */
+  uint8_t           *Data;         /* pointer to shadow */
+
+  GdramMode = 1;                   /* bypass shadow */
+
+  while (Row < LCD_DOTS_Y)         /* for all rows */
+  {
+    Bits = GdramDirty[Row];
+
+    if (Bits)                      /* row is dirty */
+    {
+      Step = 0;
+      Next = 0xff;                 /* address not set yet */
+      Data = &GdramBuffer[Row][0];
+
+      while (Bits)                 /* dirty steps left */
+      {
+        if ((Bits & 0b00000001) ||
+            ((Step == Next) && (Bits & 0b00000010)))
+        {
+          if (Step != Next)        /* address counter doesn't match */
+          {
+            LCD_DotPos(Step, Row);      /* set start position */
+          }
+
+          LCD_Data(*Data);              /* left half */
+          LCD_Data(*(Data + 1));        /* right half */
+          Next = Step + 1;              /* auto increment */
+        }
+
+        Bits >>= 1;                /* next step */
+        Step++;
+        Data += 2;
+      }
+
+      GdramDirty[Row] = 0;         /* row is clean */
+    }
+
+    Row++;                         /* next row */
+  }
+
+  GdramMode = 0;                   /* back to shadow */
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   high level functions
  * ************************************************************************ */
@@ -482,6 +686,10 @@ void LCD_DotPos(uint8_t x, uint8_t y)
   uint8_t           Cmd_X;    /* command for setting x */
   uint8_t           Cmd_Y;    /* command for setting y */
 
+  #ifdef LCD_GDRAM_SHADOW
+  if (GDRAM_Pos(x, y)) return;     /* position for GDRAM shadow */
+  #endif
+
   /* take care about address to pixel mapping */
   if (y < 32)          /* top LCD half (0-31) */
   {
@@ -601,7 +809,7 @@ void LCD_CharPos(uint8_t x, uint8_t y)
 
 
 
-#ifndef LCD_ROT180
+#if ! defined (LCD_ROT180) && ! defined (LCD_GDRAM_SHADOW)
 
 /*
  *  clear one single character line
@@ -637,6 +845,14 @@ void LCD_ClearLine(uint8_t Line)
     n++;                      /* one char done */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, n) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
   /* set start position in char matrix */
   Buffer = (unsigned char *)&Matrix;    /* start of matrix */
   Temp = (Line - 1) * LCD_CHAR_X;       /* offset for line */
@@ -689,7 +905,7 @@ void LCD_ClearLine(uint8_t Line)
 
 
 
-#ifdef LCD_ROT180
+#if defined (LCD_ROT180) && ! defined (LCD_GDRAM_SHADOW)
 
 /*
  *  clear one single character line
@@ -731,6 +947,14 @@ void LCD_ClearLine(uint8_t Line)
     LCD_Char(' ');            /* display space and keep neighbor */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, n) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
   /* set start position in char matrix (end of line) */
   Buffer = (unsigned char *)&Matrix;    /* start of matrix */
   Temp = Line * LCD_CHAR_X;             /* offset for next line */
@@ -783,6 +1007,101 @@ void LCD_ClearLine(uint8_t Line)
 
 
 
+#ifdef LCD_GDRAM_SHADOW
+
+/*
+ *  clear one single character line
+ *  - version for GDRAM shadow (also for display rotated by 180)
+ *
+ *  requires:
+ *  - Line: line number (1-)
+ *    special case line 0: clear remaining space in current line
+ */
+
+void LCD_ClearLine(uint8_t Line)
+{
+  uint8_t           n = 1;              /* counter */
+  uint8_t           Temp;               /* temp. value */
+  uint8_t           First;              /* first byte column */
+  uint8_t           Last;               /* last byte column */
+
+  if (Line == 0)         /* special case: rest of current line */
+  {
+    Line = UI.CharPos_Y;      /* get current line */
+    n = UI.CharPos_X;         /* get current character position */
+  }
+
+  /* check for row overflow */
+  Temp = Line - 1;            /* rows start at 0 */
+  Temp *= FONT_SIZE_Y;        /* offset for line */
+  if (Temp > (LCD_DOTS_Y - 1)) return;  /* overflow */
+
+  /* check for column overflow */
+  if (n > LCD_CHAR_X) return;           /* nothing left to clear */
+
+  LCD_CharPos(n, Line);       /* set char position */
+
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, n) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
+
+  /* byte columns from current char to end of line */
+  #ifdef LCD_ROT180
+  First = 0;                       /* end of line (flipped) */
+  Last = LCD_CHAR_X - n;           /* current char */
+  #else
+  First = n - 1;                   /* current char */
+  Last = LCD_CHAR_X - 1;           /* end of line */
+  #endif
+
+  /* init row range */
+  if (Line <= LCD_CHAR_Y)          /* within character lines */
+  {
+    /* clear character line */
+    n = FONT_SIZE_Y;               /* number of rows to clear */
+  }
+  else                             /* remaining rows */
+  {
+    /* clear up to last row */
+    #ifdef LCD_ROT180
+    n = Y_Start + 1;               /* number of rows to clear */
+    #else
+    n = LCD_DOTS_Y - Y_Start;      /* number of rows to clear */
+    #endif
+  }
+
+  /* clear line in shadow */
+  Line = Y_Start;                  /* starting row */
+
+  while (n > 0)                    /* loop for rows */
+  {
+    Temp = First;
+
+    while (Temp <= Last)           /* loop for columns */
+    {
+      GDRAM_Write(Temp, Line, 0);  /* clear 8 pixels */
+      Temp++;                      /* next byte */
+    }
+
+    #ifdef LCD_ROT180
+    Line--;                        /* next row */
+    #else
+    Line++;                        /* next row */
+    #endif
+    n--;                           /* next row */
+  }
+
+  GDRAM_Flush();                   /* send changes */
+}
+
+#endif
+
+
+
 /*
  *  clear the display 
  */ 
@@ -799,6 +1118,10 @@ void LCD_Clear(void)
     n++;                      /* next line */
   }
 
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
+
   LCD_CharPos(1, 1);          /* reset character position */
 }
 
@@ -883,12 +1206,16 @@ void LCD_Init(void)
   UI.SymbolSize_Y = LCD_SYMBOL_CHAR_Y;  /* y size in chars */
   #endif
 
+  #ifdef LCD_GDRAM_SHADOW
+  GDRAM_Reset();                   /* GDRAM content is unknown */
+  #endif
+
   LCD_Clear();                     /* clear screen */
 }
 
 
 
-#ifndef LCD_ROT180
+#if ! defined (LCD_ROT180) && ! defined (LCD_GDRAM_SHADOW)
 
 /*
  *  display a single character
@@ -922,6 +1249,15 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table1);        /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* calculate start address of character bitmap */
   Table1 = (uint8_t *)&FontData;        /* start address of font data */
   Offset = FONT_BYTES_N * Index;        /* offset for character */
@@ -1009,7 +1345,7 @@ void LCD_Char(unsigned char Char)
 
 
 
-#ifdef LCD_ROT180
+#if defined (LCD_ROT180) && ! defined (LCD_GDRAM_SHADOW)
 
 /*
  *  display a single character
@@ -1044,6 +1380,15 @@ void LCD_Char(unsigned char Char)
   Index = pgm_read_byte(Table1);        /* get index number */
   if (Index == 0xff) return;            /* no character bitmap available */
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
   /* calculate start address of character bitmap */
   Table1 = (uint8_t *)&FontData;        /* start address of font data */
   Offset = FONT_BYTES_N * Index;        /* offset for character */
@@ -1131,6 +1476,94 @@ void LCD_Char(unsigned char Char)
 
 
 
+#ifdef LCD_GDRAM_SHADOW
+
+/*
+ *  display a single character
+ *  - version for GDRAM shadow (also for display rotated by 180)
+ *  - no need to merge the character with its neighbor
+ *
+ *  requires:
+ *  - Char: character to display
+ */
+
+void LCD_Char(unsigned char Char)
+{
+  uint8_t           *Table;        /* pointer to table */
+  uint8_t           Index;         /* font index */
+  uint16_t          Offset;        /* address offset */
+  uint8_t           Data;          /* bitmap data */
+  uint8_t           x;             /* byte column */
+  uint8_t           y;             /* bitmap y byte counter */
+  uint8_t           Row;           /* screen row */
+
+  /* prevent x overflow */
+  if (UI.CharPos_X > LCD_CHAR_X) return;
+
+  /* get font index number from lookup table */
+  Table = (uint8_t *)&FontTable;        /* start address */
+  Table += Char;                        /* add offset for character */
+  Index = pgm_read_byte(Table);         /* get index number */
+  if (Index == 0xff) return;            /* no character bitmap available */
+
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
+  /* calculate start address of character bitmap */
+  Table = (uint8_t *)&FontData;         /* start address of font data */
+  Offset = FONT_BYTES_N * Index;        /* offset for character */
+  Table += Offset;                      /* address of character data */
+
+  /* byte column of character */
+  #ifdef LCD_ROT180
+  x = LCD_CHAR_X - UI.CharPos_X;        /* flipped */
+  #else
+  x = UI.CharPos_X - 1;                 /* columns start at 0 */
+  #endif
+
+  /* write character bitmap to shadow */
+  y = FONT_BYTES_Y;                     /* number of bytes for Y */
+  Row = Y_Start;                        /* get start row for screen */
+
+  while (y > 0)                         /* loop for Y */
+  {
+    Data = pgm_read_byte(Table);        /* read byte */
+    Table++;                            /* address for next byte */
+    GDRAM_Write(x, Row, Data);          /* write byte */
+
+    y--;                                /* next byte */
+    #ifdef LCD_ROT180
+    Row--;                              /* next row */
+    #else
+    Row++;                              /* next row */
+    #endif
+  }
+
+  GDRAM_Flush();                        /* send changes */
+
+  /* update character position */
+  if ((UI.CharPos_X % 2) == 0)     /* right byte of 16 bit step */
+  {
+    /* also update X dot position */
+    #ifdef LCD_ROT180
+    X_Start--;
+    #else
+    X_Start++;
+    #endif
+  }
+  UI.CharPos_X++;                  /* next character in current line */
+}
+
+#endif
+
+
+
 /*
  *  set cursor
  *
@@ -1186,6 +1619,11 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           Row;           /* screen row */
   uint8_t           StepFlag = 0;  /* offset control flag */
 
+  #ifdef UI_TEXT_SHADOW
+  /* text shadow doesn't know the symbol */
+  Shadow_Invalidate(LCD_SYMBOL_CHAR_X, LCD_SYMBOL_CHAR_Y);
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
@@ -1242,6 +1680,10 @@ void LCD_Symbol(uint8_t ID)
     Row++;                              /* next row */
   }
 
+  #ifdef LCD_GDRAM_SHADOW
+  GDRAM_Flush();                   /* send changes */
+  #endif
+
   /* hint: we don't update the char position */
 
   #undef OFFSET_RIGHT
@@ -1275,6 +1717,11 @@ void LCD_Symbol(uint8_t ID)
   uint8_t           Row;           /* screen row */
   uint8_t           StepFlag = 0;  /* offset control flag */
 
+  #ifdef UI_TEXT_SHADOW
+  /* text shadow doesn't know the symbol */
+  Shadow_Invalidate(LCD_SYMBOL_CHAR_X, LCD_SYMBOL_CHAR_Y);
+  #endif
+
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
@@ -1342,6 +1789,10 @@ void LCD_Symbol(uint8_t ID)
     Row--;                              /* next row */
   }
 
+  #ifdef LCD_GDRAM_SHADOW
+  GDRAM_Flush();                   /* send changes */
+  #endif
+
   /* hint: we don't update the char position */
 
   #undef OFFSET_RIGHT
@@ -7,6 +7,19 @@
  * ************************************************************************ */
 
 
+/*
+ *  hints:
+ *  - the driver keeps track of the terminal's cursor and sends the
+ *    shortest sequence to move it, absolute or relative
+ *  - the last column per line which might not be blank is tracked too,
+ *    so blank cells and lines are skipped and the rest of a line is
+ *    cleared by a single Esc[K
+ *  - a small gap of blank or unchanged cells (UI_TEXT_SHADOW) is redrawn
+ *    instead of moving the cursor
+ *  - the foreground color isn't changed for blanks
+ */
+
+
 /* local includes */
 #include "config.h"           /* global configuration */
 
@@ -38,6 +51,13 @@
 /* escape */
 #define VT100_ESCAPE     0x1b      /* escape character */
 
+/* horizontal cursor moves */
+#define MOVE_NONE        0         /* keep column */
+#define MOVE_RIGHT       1         /* Esc[<n>C */
+#define MOVE_LEFT        2         /* Esc[<n>D */
+#define MOVE_CR          3         /* carriage return plus Esc[<n>C */
+#define MOVE_REDRAW      4         /* redraw unchanged cells */
+
 
 /*
  *  local variables
@@ -48,6 +68,13 @@
 uint8_t             Color = 0;     /* foreground color ID */
 #endif
 
+/* terminal's cursor position (0 = unknown) */
+uint8_t             Term_X = 0;    /* column */
+uint8_t             Term_Y = 0;    /* line */
+
+/* last column per line which might not be blank */
+uint8_t             LineEnd[LCD_CHAR_Y];
+
 
 
 /* ************************************************************************
@@ -111,6 +138,216 @@ void LCD_SendNumber(uint8_t Number)
 
 
 
+/*
+ *  get number of bytes for a number sent as parameter
+ *  - 1 is the default and isn't sent
+ *
+ *  requires:
+ *  - number (1-255)
+ *
+ *  returns:
+ *  - number of digits
+ */
+
+uint8_t LCD_NumberSize(uint8_t Number)
+{
+  uint8_t           Size = 0;      /* return value */
+
+  if (Number > 1)                  /* not default */
+  {
+    Size++;                        /* one digit */
+    if (Number >= 10) Size++;      /* two digits */
+    if (Number >= 100) Size++;     /* three digits */
+  }
+
+  return Size;
+}
+
+
+
+/*
+ *  send control sequence with a single parameter: Esc[<n><Cmd>
+ *  - 1 is the default and isn't sent
+ *
+ *  requires:
+ *  - Number: parameter (1-255)
+ *  - Cmd: command character
+ */
+
+void LCD_SendSequence(uint8_t Number, unsigned char Cmd)
+{
+  Serial_Char(VT100_ESCAPE);       /* send: escape */
+  Serial_Char('[');                /* send: [ */
+  if (Number > 1)                  /* not default */
+  {
+    LCD_SendNumber(Number);        /* send parameter */
+  }
+  Serial_Char(Cmd);                /* send command */
+}
+
+
+
+/*
+ *  get character of a cell which is on screen already
+ *
+ *  requires:
+ *  - x: horizontal position (1-)
+ *  - y: vertical position (1-)
+ *
+ *  returns:
+ *  - character
+ *  - 0 if unknown or shown in another color
+ */
+
+unsigned char LCD_CellChar(uint8_t x, uint8_t y)
+{
+  unsigned char     Char = 0;      /* return value */
+  #ifdef UI_TEXT_SHADOW
+  uint16_t          Pen = 0;       /* current color of terminal */
+  #endif
+
+  if ((y <= LCD_CHAR_Y) && (x > LineEnd[y - 1]))
+  {
+    Char = ' ';                    /* blank */
+  }
+  #ifdef UI_TEXT_SHADOW
+  else                             /* ask screen buffer */
+  {
+    #ifdef LCD_COLOR
+    Pen = Color;
+    #endif
+
+    Char = Shadow_Char(x, y, Pen);
+  }
+  #endif
+
+  return Char;
+}
+
+
+
+/*
+ *  move terminal's cursor to current character position
+ *  - sends the shortest sequence
+ */
+
+void LCD_MoveCursor(void)
+{
+  uint8_t           x, y;          /* character position */
+  uint8_t           Size;          /* bytes for absolute position */
+  uint8_t           Bytes;         /* bytes for relative move */
+  uint8_t           Temp;          /* temporary value */
+  uint8_t           Move = MOVE_NONE;   /* horizontal move */
+
+  x = UI.CharPos_X;
+  y = UI.CharPos_Y;
+
+  /* at position already */
+  if ((x == Term_X) && (y == Term_Y)) return;
+
+  /* absolute: Esc[<y>;<x>H (parameters are optional for 1) */
+  Size = 3 + LCD_NumberSize(y);
+  if (x > 1) Size += 1 + LCD_NumberSize(x);
+  Bytes = Size;
+
+  if (Term_X > 0)                  /* cursor position is known */
+  {
+    /* vertical: Esc[<n>A or Esc[<n>B */
+    Bytes = 0;
+    if (y > Term_Y) Bytes = 3 + LCD_NumberSize(y - Term_Y);
+    else if (y < Term_Y) Bytes = 3 + LCD_NumberSize(Term_Y - y);
+
+    if (x > Term_X)                /* to the right */
+    {
+      Temp = x - Term_X;           /* number of cells */
+      Move = MOVE_RIGHT;
+
+      /* a small gap in the same line can be redrawn */
+      if ((y == Term_Y) && (Temp <= 3))
+      {
+        Move = MOVE_REDRAW;
+        while (Temp > 0)           /* check cells of gap */
+        {
+          Temp--;
+          if (LCD_CellChar(x - 1 - Temp, y) == 0)
+          {
+            Move = MOVE_RIGHT;     /* unknown cell */
+          }
+        }
+
+        Temp = x - Term_X;         /* number of cells */
+      }
+
+      if (Move == MOVE_REDRAW) Bytes += Temp;      /* cells */
+      else Bytes += 3 + LCD_NumberSize(Temp);      /* Esc[<n>C */
+    }
+    else if (x < Term_X)           /* to the left */
+    {
+      /* carriage return: CR or CR plus Esc[<x-1>C */
+      Temp = 1;
+      if (x > 1) Temp += 3 + LCD_NumberSize(x - 1);
+      Move = MOVE_CR;
+
+      /* cursor left: Esc[<n>D */
+      if (3 + LCD_NumberSize(Term_X - x) < Temp)
+      {
+        Temp = 3 + LCD_NumberSize(Term_X - x);
+        Move = MOVE_LEFT;
+      }
+
+      Bytes += Temp;
+    }
+  }
+
+  if (Bytes >= Size)               /* absolute position is shorter */
+  {
+    Serial_Char(VT100_ESCAPE);     /* send: escape */
+    Serial_Char('[');              /* send: [ */
+    if (y > 1) LCD_SendNumber(y);  /* send y pos */
+    if (x > 1)
+    {
+      Serial_Char(';');            /* send: ; */
+      LCD_SendNumber(x);           /* send x pos */
+    }
+    Serial_Char('H');              /* send: H */
+  }
+  else                             /* relative move */
+  {
+    /* vertical */
+    if (y > Term_Y) LCD_SendSequence(y - Term_Y, 'B');
+    else if (y < Term_Y) LCD_SendSequence(Term_Y - y, 'A');
+
+    /* horizontal */
+    if (Move == MOVE_RIGHT)
+    {
+      LCD_SendSequence(x - Term_X, 'C');
+    }
+    else if (Move == MOVE_LEFT)
+    {
+      LCD_SendSequence(Term_X - x, 'D');
+    }
+    else if (Move == MOVE_CR)
+    {
+      Serial_Char('\r');           /* send: carriage return */
+      if (x > 1) LCD_SendSequence(x - 1, 'C');
+    }
+    else if (Move == MOVE_REDRAW)
+    {
+      while (Term_X < x)           /* redraw cells */
+      {
+        Serial_Char(LCD_CellChar(Term_X, y));
+        Term_X++;
+      }
+    }
+  }
+
+  /* update cursor position */
+  Term_X = x;
+  Term_Y = y;
+}
+
+
+
 /*
  *  set color
  *  - foreground, background and special features
@@ -150,13 +387,10 @@ void LCD_CharPos(uint8_t x, uint8_t y)
   UI.CharPos_X = x;
   UI.CharPos_Y = y;
 
-  /* move cursor to screen location x,y: Esc[<y>;<x>H */
-  Serial_Char(VT100_ESCAPE);       /* send: escape */
-  Serial_Char('[');                /* send: [ */
-  LCD_SendNumber(y);               /* send y pos */
-  Serial_Char(';');                /* send: ; */
-  LCD_SendNumber(x);               /* send x pos */
-  Serial_Char('H');                /* send: H */
+  /*
+   *  we don't move the cursor here
+   *  - LCD_MoveCursor() is called when something is sent
+   */
 }
 
 
@@ -179,22 +413,27 @@ void LCD_ClearLine(uint8_t Line)
     X = UI.CharPos_X;         /* get current character position */
   }
 
-  LCD_CharPos(X, Line);       /* set char position */
-
-  /*
-   *  clear entire line: Esc[2K
-   *  clear line from cursor right: Esc[K
-   */
+  #ifdef UI_TEXT_SHADOW
+  /* skip line if it's blank already */
+  if (Shadow_ClearLine(Line, X) == 0)
+  {
+    return;                        /* nothing to do */
+  }
+  #endif
 
-  Serial_Char(VT100_ESCAPE);       /* send: escape */
-  Serial_Char('[');                /* send: [ */
+  LCD_CharPos(X, Line);       /* set char position */
 
-  if (X == 1)                      /* complete line */
+  if (Line <= LCD_CHAR_Y)     /* within character lines */
   {
-    Serial_Char('2');              /* send: 2 */
+    /* skip if rest of line is blank already */
+    if (X > LineEnd[Line - 1]) return;
+    LineEnd[Line - 1] = X - 1;     /* blank from X on */
   }
 
-  Serial_Char('K');                /* send: K */
+  LCD_MoveCursor();           /* move cursor */
+
+  /* clear line from cursor right: Esc[K */
+  LCD_SendSequence(1, 'K');
 }
 
 
@@ -205,11 +444,21 @@ void LCD_ClearLine(uint8_t Line)
 
 void LCD_Clear(void)
 {
+  uint8_t           n = 0;         /* counter */
+
   /* clear entire screen: Esc[2J */
-  Serial_Char(VT100_ESCAPE);       /* send: escape */
-  Serial_Char('[');                /* send: [ */
-  Serial_Char('2');                /* send: 2 */
-  Serial_Char('J');                /* send: J */
+  LCD_SendSequence(2, 'J');
+
+  /* all lines are blank */
+  while (n < LCD_CHAR_Y)
+  {
+    LineEnd[n] = 0;
+    n++;
+  }
+
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Blank();                  /* screen is blank now */
+  #endif
 
   LCD_CharPos(1, 1);               /* reset character position */
 }
@@ -239,6 +488,8 @@ void LCD_Init(void)
   LCD_SetColor(COLOR_BACKGROUND + 10);
   #endif
 
+  Term_X = 0;                      /* cursor position is unknown */
+
   LCD_Clear();                     /* clear display */
 }
 
@@ -252,12 +503,50 @@ void LCD_Init(void)
 
 void LCD_Char(unsigned char Char)
 {
+  uint8_t           *End = NULL;   /* last column of line */
+
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
 
+  #ifdef UI_TEXT_SHADOW
+  /* skip character if it's on screen already */
+  if (Shadow_Check(Char))
+  {
+    UI.CharPos_X++;                     /* update character position */
+    return;
+  }
+  #endif
+
+  /* skip blank cell */
+  if (UI.CharPos_Y <= LCD_CHAR_Y)  /* within character lines */
+  {
+    End = &LineEnd[UI.CharPos_Y - 1];
+
+    if ((Char == ' ') && (UI.CharPos_X > *End))
+    {
+      UI.CharPos_X++;              /* update character position */
+      return;                      /* cell is blank already */
+    }
+  }
+
+  LCD_MoveCursor();                /* move cursor (might redraw blanks) */
+
+  /* update last column of line */
+  if (End)                         /* within character lines */
+  {
+    if (Char == ' ')               /* blank */
+    {
+      if (UI.CharPos_X == *End) (*End)--;    /* last one is blank now */
+    }
+    else if (UI.CharPos_X > *End)  /* beyond last column */
+    {
+      *End = UI.CharPos_X;         /* new last column */
+    }
+  }
+
   #ifdef LCD_COLOR
-  /* only set color after a change */
-  if (UI.PenColor != Color)        /* color has changed */
+  /* only set color after a change (blank doesn't need a color) */
+  if ((UI.PenColor != Color) && (Char != ' '))
   {
     Color = UI.PenColor;           /* update color ID */
     LCD_SetColor(Color);           /* and set new color */
@@ -266,6 +555,13 @@ void LCD_Char(unsigned char Char)
 
   Serial_Char(Char);               /* send character */
 
+  /* update cursor position */
+  Term_X++;                        /* terminal's cursor */
+  if (Term_X > LCD_CHAR_X)         /* might be at right margin */
+  {
+    Term_X = 0;                    /* unknown */
+  }
+
   /* update character position */
   UI.CharPos_X++;                  /* next character in current line */
 }
@@ -302,6 +598,13 @@ void LCD_Cursor(uint8_t Mode)
  * ************************************************************************ */
 
 
+/* local constants */
+#undef MOVE_NONE
+#undef MOVE_RIGHT
+#undef MOVE_LEFT
+#undef MOVE_CR
+#undef MOVE_REDRAW
+
 /* source management */
 #undef LCD_DRIVER_C
 
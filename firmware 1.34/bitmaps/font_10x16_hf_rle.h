@@ -0,0 +1,619 @@
+/* ************************************************************************
+ *
+ *   fixed 10x16 font based on ISO 8859-1
+ *   horizontally aligned, run-length encoded
+ *   generated by rle.py from font_10x16_hf.h, do not edit
+ *
+ *   (c) 2016-2018 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   font data
+ * ************************************************************************ */
+
+#ifdef FONT_10X16_HF
+
+
+/* font size */
+#define FONT_SIZE_X         10     /* width:  10 dots */
+#define FONT_SIZE_Y         16     /* heigth: 16 dots */
+
+/* font data format */
+#define FONT_RLE                   /* run-length encoded */
+
+
+/*
+ *  character bitmaps
+ *  - to reduce size we place some symbols and special characters at
+ *    positions 0-15, and we move the standard chars up in the list by
+ *    16 positions (using ASCII's 0-31 for control chars)
+ *  - format:
+ *    - pixel runs of alternating color, starting with
+ *      background, pixels row by row (top to down)
+ *    - nibbles, high nibble first: 15 adds 15 pixels
+ *      and continues the run, 0-14 adds the number
+ *      of pixels and ends the run
+ *    - each bitmap starts at a byte boundary
+ *    - 1894 bytes plus offset table (uncompressed 3552 bytes)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,                                                       /* 0x00 n/a */
+  0xF6,0x15,0x13,0x24,0x13,0x33,0x13,0x42,0x13,0x51,0x12,0xA1,0x51,0x13,0x42,0x13,
+  0x33,0x13,0x24,0x13,0x15,0x1F,0xF2,                                                  /* 0x01 symbol: diode A-C */
+  0xF6,0x15,0x13,0x14,0x23,0x13,0x33,0x12,0x43,0x11,0x52,0xA1,0x11,0x53,0x12,0x43,
+  0x13,0x33,0x14,0x23,0x15,0x1F,0xF2,                                                  /* 0x02 symbol: diode C-A */
+  0xF6,0x24,0x22,0x24,0x22,0x24,0x22,0x24,0x22,0x24,0x21,0x34,0x31,0x24,0x22,0x24,
+  0x22,0x24,0x22,0x24,0x22,0x24,0x2F,0xF1,                                             /* 0x03 symbol: capacitor */
+  0xD4,0x51,0x41,0x31,0x61,0x21,0x61,0x21,0x61,0x21,0x61,0x21,0x61,0x31,0x41,0x51,
+  0x21,0x61,0x21,0x61,0x21,0x42,0x42,0xFF,0x10,                                        /* 0x04 omega */
+  0xFF,0xF6,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x23,0x23,
+  0x11,0x31,0x13,0x19,0x19,0x18,                                                       /* 0x05  (micro) */
+  0xF6,0x91,0x19,0x19,0x19,0x18,0x29,0x19,0x19,0x19,0x19,0x9F,0xF0,                    /* 0x06 symbol: resistor left side */
+  0xF5,0x99,0x19,0x19,0x19,0x19,0x28,0x19,0x19,0x19,0x11,0x9F,0xF1,                    /* 0x07 symbol: resistor right side */
+
+  0x21,0x31,0xFC,0x18,0x37,0x11,0x17,0x12,0x15,0x13,0x15,0x14,0x13,0x73,0x16,0x12,
+  0x16,0x11,0x18,0x1F,0xF0,                                                            /* 0x08  */
+  0x21,0x31,0xFB,0x45,0x14,0x13,0x16,0x12,0x16,0x12,0x16,0x12,0x16,0x12,0x16,0x12,
+  0x16,0x13,0x14,0x15,0x4F,0xF3,                                                       /* 0x09  */
+  0x21,0x31,0xF9,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x15,
+  0x13,0x15,0x14,0x13,0x15,0x4F,0xF4,                                                  /* 0x0a  */
+  0xC3,0x61,0x31,0x51,0x31,0x51,0x31,0x51,0x21,0x61,0x21,0x61,0x21,0x61,0x31,0x51,
+  0x41,0x41,0x51,0x31,0x51,0x31,0x23,0xFF,0x30,                                        /* 0x0b  */
+  0xF7,0x12,0x1F,0xB4,0xA1,0x91,0x64,0x51,0x31,0x41,0x41,0x41,0x32,0x53,0x12,0xFF,
+  0x20,                                                                                /* 0x0c  */
+  0xF7,0x12,0x1F,0xC3,0x61,0x31,0x41,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x41,0x31,
+  0x63,0xFF,0x40,                                                                      /* 0x0d  */
+  0xF7,0x12,0x1F,0xA1,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,
+  0x32,0x53,0x11,0xFF,0x30,                                                            /* 0x0e  */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,                                                       /* 0x0f n/a */
+
+  /* standard characters */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,                                                       /* 0x10 space */
+  0xE1,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xF4,0x19,0x1F,0xF5,                    /* 0x11 ! */
+  0xC1,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0xFF,0xFF,0xFF,0xF8,                         /* 0x12 " */
+  0xE1,0x21,0x61,0x21,0x51,0x21,0x61,0x21,0x48,0x41,0x21,0x51,0x21,0x49,0x31,0x21,
+  0x61,0x21,0x51,0x21,0x61,0x21,0xFF,0x50,                                             /* 0x13 # */
+  0x51,0x75,0x42,0x11,0x61,0x21,0x61,0x21,0x71,0x11,0x82,0x92,0x83,0x71,0x11,0x71,
+  0x11,0x41,0x21,0x11,0x45,0x81,0xF9,                                                  /* 0x14 $ */
+  0xB3,0x52,0x31,0x31,0x11,0x31,0x21,0x21,0x31,0x11,0x43,0x21,0x81,0x81,0x81,0x23,
+  0x41,0x11,0x31,0x21,0x21,0x31,0x11,0x31,0x32,0x53,0xFF,0x10,                         /* 0x15 % */
+  0xD3,0x61,0x31,0x51,0x31,0x51,0x22,0x63,0x62,0x71,0x21,0x42,0x32,0x32,0x41,0x21,
+  0x11,0x51,0x11,0x21,0x42,0x47,0xFF,0x10,                                             /* 0x16 & */
+  0xE1,0x91,0x91,0x91,0xFF,0xFF,0xFF,0xFA,                                             /* 0x17  */
+  0xF2,0x26,0x27,0x28,0x18,0x19,0x19,0x19,0x19,0x19,0x1A,0x19,0x29,0x2A,0x2B,          /* 0x18 ( */
+  0xB2,0xA2,0x92,0x91,0xA1,0x91,0x91,0x91,0x91,0x91,0x81,0x82,0x72,0x62,0xF2,          /* 0x19 ) */
+  0xE1,0x91,0x62,0x11,0x12,0x42,0x12,0x61,0x11,0x73,0x71,0x11,0xFF,0xFF,0xF9,          /* 0x1a * */
+  0xFF,0xF9,0x19,0x19,0x19,0x15,0x95,0x19,0x19,0x1F,0xF5,                              /* 0x1b + */
+  0xFF,0xFF,0xFF,0xF8,0x28,0x29,0x19,0x18,0x16,                                        /* 0x1c , */
+  0xFF,0xFF,0xF7,0x6F,0xFF,0xFC,                                                       /* 0x1d - */
+  0xFF,0xFF,0xFF,0xF8,0x28,0x2F,0xF5,                                                  /* 0x1e . */
+  0xF3,0x18,0x19,0x18,0x19,0x18,0x19,0x18,0x19,0x18,0x19,0x18,0x19,0x18,0x1F,0x30,     /* 0x1f / */
+  0xD3,0x61,0x31,0x51,0x31,0x41,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,
+  0x51,0x41,0x31,0x51,0x31,0x63,0xFF,0x40,                                             /* 0x20 0 */
+  0xE1,0x64,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x67,0xFF,0x20,               /* 0x21 1 */
+  0xB5,0x51,0x41,0x91,0x91,0x91,0x81,0x91,0x81,0x81,0x81,0x81,0x96,0xFF,0x30,          /* 0x22 2 */
+  0xC4,0xA1,0x91,0x91,0x91,0x63,0xA1,0x91,0x91,0x91,0x91,0x54,0xFF,0x40,               /* 0x23 3 */
+  0xF0,0x18,0x27,0x11,0x17,0x11,0x16,0x12,0x15,0x13,0x15,0x13,0x14,0x14,0x14,0x87,
+  0x19,0x19,0x1F,0xF4,                                                                 /* 0x24 4 */
+  0xC5,0x51,0x91,0x91,0x93,0xA1,0xA1,0x91,0x91,0x91,0x81,0x63,0xFF,0x50,               /* 0x25 5 */
+  0xD4,0x51,0x91,0x81,0x91,0x13,0x52,0x31,0x41,0x51,0x31,0x51,0x31,0x51,0x31,0x51,
+  0x41,0x31,0x63,0xFF,0x40,                                                            /* 0x26 6 */
+  0xB7,0x91,0x81,0x81,0x91,0x81,0x91,0x81,0x91,0x91,0x81,0x91,0xFF,0x70,               /* 0x27 7 */
+  0xC5,0x41,0x51,0x31,0x51,0x31,0x51,0x41,0x22,0x62,0x71,0x22,0x41,0x41,0x41,0x51,
+  0x31,0x51,0x31,0x41,0x54,0xFF,0x40,                                                  /* 0x28 8 */
+  0xD3,0x61,0x31,0x41,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x41,0x32,0x53,0x11,0x91,
+  0x81,0x91,0x54,0xFF,0x40,                                                            /* 0x29 9 */
+  0xFF,0xF8,0x28,0x2F,0xFF,0x32,0x82,0xFF,0x50,                                        /* 0x2a : */
+  0xFF,0xF8,0x28,0x2F,0xFF,0x32,0x82,0x91,0x91,0x81,0x60,                              /* 0x2b ; */
+  0xFF,0xFD,0x17,0x26,0x26,0x28,0x2A,0x2A,0x2A,0x1F,0xF1,                              /* 0x2c < */
+  0xFF,0xFF,0xB8,0xF7,0x8F,0xFF,0x60,                                                  /* 0x2d = */
+  0xFF,0xF6,0x1A,0x2A,0x2A,0x28,0x26,0x26,0x27,0x1F,0xF8,                              /* 0x2e > */
+  0xB6,0x41,0x42,0x31,0x51,0x91,0x81,0x81,0x81,0x81,0x91,0xF4,0x19,0x1F,0xF6,          /* 0x2f ? */
+  0xD4,0x51,0x41,0x31,0x33,0x22,0x21,0x21,0x21,0x21,0x31,0x21,0x21,0x31,0x21,0x21,
+  0x22,0x21,0x21,0x22,0x21,0x21,0x13,0x31,0x22,0x13,0x12,0x31,0x55,0xFF,0x30,          /* 0x30 @ */
+  0xFF,0x41,0x83,0x71,0x11,0x71,0x21,0x51,0x31,0x51,0x41,0x37,0x31,0x61,0x21,0x61,
+  0x11,0x81,0xFF,0x00,                                                                 /* 0x31 A */
+  0xFF,0x16,0x41,0x51,0x31,0x51,0x31,0x41,0x45,0x51,0x41,0x41,0x51,0x31,0x51,0x31,
+  0x51,0x36,0xFF,0x30,                                                                 /* 0x32 B */
+  0xFF,0x35,0x32,0x41,0x31,0x81,0x91,0x91,0x91,0xA1,0x92,0xA5,0xFF,0x20,               /* 0x33 C */
+  0xFF,0x15,0x51,0x41,0x41,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0x51,
+  0x31,0x41,0x45,0xFF,0x40,                                                            /* 0x34 D */
+  0xFF,0x17,0x31,0x91,0x91,0x91,0x96,0x41,0x91,0x91,0x97,0xFF,0x20,                    /* 0x35 E */
+  0xFF,0x17,0x31,0x91,0x91,0x91,0x96,0x41,0x91,0x91,0x91,0xFF,0x80,                    /* 0x36 F */
+  0xFF,0x45,0x32,0x41,0x31,0x81,0x91,0x91,0x43,0x21,0x61,0x31,0x51,0x32,0x41,0x55,
+  0xFF,0x10,                                                                           /* 0x37 G */
+  0xFF,0x11,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x37,0x31,0x51,0x31,0x51,
+  0x31,0x51,0x31,0x51,0xFF,0x20,                                                       /* 0x38 H */
+  0xFF,0x17,0x61,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x67,0xFF,0x20,                    /* 0x39 I */
+  0xFF,0x34,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x54,0xFF,0x40,                    /* 0x3a J */
+  0xFF,0x11,0x51,0x31,0x41,0x41,0x31,0x51,0x21,0x63,0x71,0x11,0x71,0x21,0x61,0x32,
+  0x41,0x51,0x31,0x61,0xFF,0x10,                                                       /* 0x3b K */
+  0xFF,0x11,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x97,0xFF,0x20,                    /* 0x3c L */
+  0xFF,0x02,0x42,0x22,0x42,0x23,0x32,0x21,0x11,0x21,0x11,0x21,0x11,0x21,0x11,0x21,
+  0x12,0x11,0x11,0x21,0x22,0x21,0x21,0x22,0x21,0x21,0x61,0x21,0x61,0xFF,0x20,          /* 0x3d M */
+  0xFF,0x11,0x51,0x32,0x41,0x31,0x11,0x31,0x31,0x11,0x31,0x31,0x21,0x21,0x31,0x21,
+  0x21,0x31,0x31,0x11,0x31,0x31,0x11,0x31,0x42,0x31,0x51,0xFF,0x20,                    /* 0x3e N */
+  0xFF,0x34,0x51,0x41,0x31,0x61,0x21,0x61,0x21,0x61,0x21,0x61,0x21,0x61,0x21,0x61,
+  0x31,0x41,0x54,0xFF,0x30,                                                            /* 0x3f O */
+  0xFF,0x16,0x41,0x51,0x31,0x51,0x31,0x51,0x31,0x41,0x45,0x51,0x91,0x91,0x91,0xFF,
+  0x80,                                                                                /* 0x40 P */
+  0xFF,0x34,0x51,0x41,0x31,0x61,0x21,0x61,0x21,0x61,0x21,0x61,0x21,0x61,0x21,0x61,
+  0x31,0x41,0x54,0x91,0xA2,0xB0,                                                       /* 0x41 Q */
+  0xFF,0x15,0x51,0x41,0x41,0x41,0x41,0x41,0x41,0x31,0x54,0x61,0x21,0x61,0x31,0x51,
+  0x41,0x41,0x51,0xFF,0x20,                                                            /* 0x42 R */
+  0xFF,0x26,0x31,0x51,0x31,0x92,0xA2,0xA2,0xA1,0x91,0x31,0x42,0x35,0xFF,0x40,          /* 0x43 S */
+  0xFF,0x09,0x51,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xFF,0x50,                    /* 0x44 T */
+  0xFF,0x11,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,0x51,0x31,
+  0x51,0x41,0x31,0x54,0xFF,0x40,                                                       /* 0x45 U */
+  0xFF,0x01,0x81,0x11,0x61,0x21,0x61,0x31,0x41,0x41,0x41,0x41,0x31,0x61,0x21,0x61,
+  0x21,0x72,0x82,0xFF,0x40,                                                            /* 0x46 V */
+  0xFF,0x01,0x82,0x81,0x11,0x21,0x31,0x21,0x22,0x21,0x21,0x22,0x21,0x21,0x11,0x11,
+  0x21,0x21,0x11,0x21,0x11,0x32,0x22,0x42,0x22,0x41,0x41,0xFF,0x20,                    /* 0x47 W */
+  0xFF,0x01,0x81,0x11,0x61,0x31,0x41,0x51,0x21,0x72,0x82,0x71,0x21,0x51,0x41,0x31,
+  0x61,0x11,0x81,0xFF,0x00,                                                            /* 0x48 X */
+  0xFF,0x01,0x81,0x11,0x61,0x31,0x41,0x41,0x31,0x61,0x11,0x81,0x91,0x91,0x91,0x91,
+  0xFF,0x50,                                                                           /* 0x49 Y */
+  0xFF,0x18,0x91,0x81,0x81,0x81,0x81,0x81,0x81,0x81,0x98,0xFF,0x10,                    /* 0x4a Z */
+  0xD5,0x51,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x95,0xC0,          /* 0x4b [ */
+  0xB1,0xA1,0x91,0xA1,0x91,0xA1,0x91,0xA1,0x91,0xA1,0x91,0xA1,0x91,0xA1,0xB0,          /* 0x4c \ */
+  0xB5,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x55,0xE0,          /* 0x4d ] */
+  0xF0,0x19,0x18,0x28,0x11,0x16,0x21,0x16,0x12,0x16,0x13,0x14,0x14,0x14,0x14,0x13,
+  0x16,0x1F,0xFF,0x60,                                                                 /* 0x4e ^ */
+  0xFF,0xFF,0xFF,0xFF,0xAA,0xF5,                                                       /* 0x4f _ */
+  0x41,0xA1,0xFF,0xFF,0xFF,0xFF,0xF9,                                                  /* 0x50 ` */
+  0xFF,0xF7,0x4A,0x19,0x16,0x45,0x13,0x14,0x14,0x14,0x13,0x25,0x31,0x2F,0xF2,          /* 0x51 a */
+  0xB1,0x91,0x91,0x91,0x91,0x14,0x42,0x31,0x41,0x51,0x31,0x51,0x31,0x51,0x31,0x51,
+  0x32,0x31,0x41,0x13,0xFF,0x40,                                                       /* 0x52 b */
+  0xFF,0xF8,0x54,0x18,0x19,0x19,0x19,0x1A,0x1A,0x5F,0xF2,                              /* 0x53 c */
+  0xF2,0x19,0x19,0x19,0x15,0x31,0x14,0x13,0x23,0x15,0x13,0x15,0x13,0x15,0x13,0x15,
+  0x14,0x13,0x24,0x41,0x1F,0xF2,                                                       /* 0x54 d */
+  0xFF,0xF8,0x45,0x14,0x13,0x15,0x13,0x73,0x19,0x1A,0x1A,0x5F,0xF2,                    /* 0x55 e */
+  0xF0,0x44,0x28,0x19,0x17,0x84,0x19,0x19,0x19,0x19,0x19,0x19,0x1F,0xF6,               /* 0x56 f */
+  0xFF,0xF8,0x31,0x14,0x13,0x23,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x14,0x13,0x24,
+  0x41,0x19,0x18,0x15,0x44,                                                            /* 0x57 g */
+  0xB1,0x91,0x91,0x91,0x91,0x23,0x41,0x11,0x31,0x32,0x41,0x31,0x51,0x31,0x51,0x31,
+  0x51,0x31,0x51,0x31,0x51,0xFF,0x20,                                                  /* 0x58 h */
+  0xD2,0x82,0xFB,0x49,0x19,0x19,0x19,0x19,0x19,0x19,0x1F,0xF5,                         /* 0x59 i */
+  0xE2,0x82,0xFB,0x49,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x15,0x45,               /* 0x5a j */
+  0xB1,0x91,0x91,0x91,0x91,0x51,0x31,0x32,0x41,0x21,0x63,0x71,0x11,0x71,0x22,0x51,
+  0x41,0x41,0x51,0xFF,0x20,                                                            /* 0x5b k */
+  0xC4,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xFF,0x40,               /* 0x5c l */
+  0xFF,0xF5,0x11,0x22,0x22,0x22,0x22,0x11,0x13,0x13,0x11,0x13,0x13,0x11,0x13,0x13,
+  0x11,0x13,0x13,0x11,0x13,0x13,0x11,0x13,0x13,0x1F,0xF1,                              /* 0x5d m */
+  0xFF,0xF6,0x12,0x34,0x33,0x13,0x24,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,
+  0x15,0x1F,0xF2,                                                                      /* 0x5e n */
+  0xFF,0xF8,0x36,0x13,0x14,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x14,0x13,0x16,0x3F,
+  0xF4,                                                                                /* 0x5f o */
+  0xFF,0xF6,0x11,0x44,0x23,0x14,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x13,0x23,0x14,
+  0x11,0x35,0x19,0x19,0x18,                                                            /* 0x60 p */
+  0xFF,0xF8,0x31,0x14,0x13,0x23,0x15,0x13,0x15,0x13,0x15,0x13,0x15,0x14,0x13,0x24,
+  0x41,0x19,0x19,0x19,0x12,                                                            /* 0x61 q */
+  0xFF,0xF7,0x12,0x34,0x11,0x12,0x14,0x23,0x14,0x19,0x19,0x19,0x19,0x1F,0xF7,          /* 0x62 r */
+  0xFF,0xF7,0x54,0x19,0x1A,0x2A,0x2A,0x14,0x14,0x14,0x5F,0xF4,                         /* 0x63 s */
+  0xFF,0x31,0x91,0x77,0x51,0x91,0x91,0x91,0x91,0x91,0xA4,0xFF,0x20,                    /* 0x64 t */
+  0xFF,0xF6,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x13,0x25,
+  0x31,0x1F,0xF3,                                                                      /* 0x65 u */
+  0xFF,0xF5,0x17,0x12,0x15,0x13,0x15,0x13,0x14,0x15,0x13,0x15,0x12,0x17,0x11,0x17,
+  0x2F,0xF5,                                                                           /* 0x66 v */
+  0xFF,0xF5,0x18,0x23,0x14,0x11,0x12,0x22,0x12,0x12,0x22,0x12,0x11,0x12,0x11,0x12,
+  0x11,0x12,0x11,0x13,0x22,0x24,0x14,0x1F,0xF2,                                        /* 0x67 w */
+  0xFF,0xF6,0x16,0x13,0x14,0x15,0x12,0x17,0x28,0x27,0x12,0x15,0x14,0x13,0x16,0x1F,
+  0xF1,                                                                                /* 0x68 x */
+  0xFF,0xF5,0x18,0x11,0x16,0x12,0x16,0x13,0x14,0x14,0x22,0x16,0x12,0x17,0x28,0x28,
+  0x18,0x16,0x37,                                                                      /* 0x69 y */
+  0xFF,0xF6,0x88,0x18,0x18,0x18,0x18,0x18,0x18,0x8F,0xF1,                              /* 0x6a z */
+  0xF0,0x36,0x19,0x19,0x19,0x19,0x19,0x17,0x2A,0x19,0x19,0x19,0x19,0x1A,0x3C,          /* 0x6b { */
+  0xE1,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xF0,          /* 0x6c | */
+  0xC3,0xA1,0x91,0x91,0x91,0x91,0x91,0xA2,0x71,0x91,0x91,0x91,0x91,0x63,0xF0,          /* 0x6d } */
+  0xFF,0xFF,0xB3,0x52,0x32,0x32,0x53,0xFF,0xFF,0x10                                    /* 0x6e ~ */
+};
+
+
+/* start of bitmaps in FontData */
+const uint16_t FontIndex[] PROGMEM = {
+  /* symbols and special characters */
+  0,        /* 0x00 n/a */
+  6,        /* 0x01 symbol: diode A-C */
+  29,       /* 0x02 symbol: diode C-A */
+  52,       /* 0x03 symbol: capacitor */
+  76,       /* 0x04 omega */
+  101,      /* 0x05  (micro) */
+  123,      /* 0x06 symbol: resistor left side */
+  136,      /* 0x07 symbol: resistor right side */
+  149,      /* 0x08  */
+  170,      /* 0x09  */
+  192,      /* 0x0a  */
+  215,      /* 0x0b  */
+  240,      /* 0x0c  */
+  257,      /* 0x0d  */
+  276,      /* 0x0e  */
+  297,      /* 0x0f n/a */
+  /* standard characters */
+  303,      /* 0x10 space */
+  309,      /* 0x11 ! */
+  322,      /* 0x12 " */
+  334,      /* 0x13 # */
+  358,      /* 0x14 $ */
+  381,      /* 0x15 % */
+  409,      /* 0x16 & */
+  433,      /* 0x17  */
+  441,      /* 0x18 ( */
+  456,      /* 0x19 ) */
+  471,      /* 0x1a * */
+  486,      /* 0x1b + */
+  497,      /* 0x1c , */
+  506,      /* 0x1d - */
+  512,      /* 0x1e . */
+  519,      /* 0x1f / */
+  535,      /* 0x20 0 */
+  559,      /* 0x21 1 */
+  573,      /* 0x22 2 */
+  588,      /* 0x23 3 */
+  602,      /* 0x24 4 */
+  622,      /* 0x25 5 */
+  636,      /* 0x26 6 */
+  657,      /* 0x27 7 */
+  671,      /* 0x28 8 */
+  694,      /* 0x29 9 */
+  715,      /* 0x2a : */
+  724,      /* 0x2b ; */
+  735,      /* 0x2c < */
+  746,      /* 0x2d = */
+  753,      /* 0x2e > */
+  764,      /* 0x2f ? */
+  779,      /* 0x30 @ */
+  810,      /* 0x31 A */
+  830,      /* 0x32 B */
+  850,      /* 0x33 C */
+  864,      /* 0x34 D */
+  885,      /* 0x35 E */
+  898,      /* 0x36 F */
+  911,      /* 0x37 G */
+  929,      /* 0x38 H */
+  951,      /* 0x39 I */
+  964,      /* 0x3a J */
+  977,      /* 0x3b K */
+  999,      /* 0x3c L */
+  1012,     /* 0x3d M */
+  1043,     /* 0x3e N */
+  1072,     /* 0x3f O */
+  1093,     /* 0x40 P */
+  1110,     /* 0x41 Q */
+  1132,     /* 0x42 R */
+  1153,     /* 0x43 S */
+  1168,     /* 0x44 T */
+  1181,     /* 0x45 U */
+  1203,     /* 0x46 V */
+  1224,     /* 0x47 W */
+  1253,     /* 0x48 X */
+  1274,     /* 0x49 Y */
+  1292,     /* 0x4a Z */
+  1305,     /* 0x4b [ */
+  1320,     /* 0x4c \ */
+  1335,     /* 0x4d ] */
+  1350,     /* 0x4e ^ */
+  1370,     /* 0x4f _ */
+  1376,     /* 0x50 ` */
+  1383,     /* 0x51 a */
+  1398,     /* 0x52 b */
+  1420,     /* 0x53 c */
+  1431,     /* 0x54 d */
+  1453,     /* 0x55 e */
+  1466,     /* 0x56 f */
+  1480,     /* 0x57 g */
+  1501,     /* 0x58 h */
+  1524,     /* 0x59 i */
+  1536,     /* 0x5a j */
+  1550,     /* 0x5b k */
+  1571,     /* 0x5c l */
+  1585,     /* 0x5d m */
+  1612,     /* 0x5e n */
+  1631,     /* 0x5f o */
+  1648,     /* 0x60 p */
+  1669,     /* 0x61 q */
+  1690,     /* 0x62 r */
+  1705,     /* 0x63 s */
+  1717,     /* 0x64 t */
+  1730,     /* 0x65 u */
+  1749,     /* 0x66 v */
+  1767,     /* 0x67 w */
+  1792,     /* 0x68 x */
+  1809,     /* 0x69 y */
+  1828,     /* 0x6a z */
+  1839,     /* 0x6b { */
+  1854,     /* 0x6c | */
+  1869,     /* 0x6d } */
+  1884      /* 0x6e ~ */
+};
+
+
+/*
+ *  font lookup table for ISO 8859-1
+ *  - 8 bit ISO 8859-1 to custom font
+ *  - ff: no bitmap available
+ */
+
+const uint8_t FontTable[] PROGMEM = {
+  0xff,        /* 0x00 -> n/a */
+  0x01,        /* 0x01 -> symbol: diode A-C */
+  0x02,        /* 0x02 -> symbol: diode C-A */
+  0x03,        /* 0x03 -> symbol: capacitor */
+  0x04,        /* 0x04 -> omega */
+  0x05,        /* 0x05 ->  (micro) */
+  0x06,        /* 0x06 -> symbol: resistor left side */
+  0x07,        /* 0x07 -> symbol: resistor right side */
+  0xff,        /* 0x08 -> n/a */
+  0xff,        /* 0x09 -> n/a */
+  0xff,        /* 0x0a -> n/a */
+  0xff,        /* 0x0b -> n/a */
+  0xff,        /* 0x0c -> n/a */
+  0xff,        /* 0x0d -> n/a */
+  0xff,        /* 0x0e -> n/a */
+  0xff,        /* 0x0f -> n/a */
+
+  0xff,        /* 0x10 -> n/a */
+  0xff,        /* 0x11 -> n/a */
+  0xff,        /* 0x12 -> n/a */
+  0xff,        /* 0x13 -> n/a */
+  0xff,        /* 0x14 -> n/a */
+  0xff,        /* 0x15 -> n/a */
+  0xff,        /* 0x16 -> n/a */
+  0xff,        /* 0x17 -> n/a */
+  0xff,        /* 0x18 -> n/a */
+  0xff,        /* 0x19 -> n/a */
+  0xff,        /* 0x1a -> n/a */
+  0xff,        /* 0x1b -> n/a */
+  0xff,        /* 0x1c -> n/a */
+  0xff,        /* 0x1d -> n/a */
+  0xff,        /* 0x1e -> n/a */
+  0xff,        /* 0x1f -> n/a */
+
+  0x10,        /* 0x20 -> space */
+  0x11,        /* 0x21 -> ! */
+  0x12,        /* 0x22 -> " */
+  0x13,        /* 0x23 -> # */
+  0x14,        /* 0x24 -> $ */
+  0x15,        /* 0x25 -> % */
+  0x16,        /* 0x26 -> & */
+  0x17,        /* 0x27 ->  */
+  0x18,        /* 0x28 -> ( */
+  0x19,        /* 0x29 -> ) */
+  0x1a,        /* 0x2a -> * */
+  0x1b,        /* 0x2b -> + */
+  0x1c,        /* 0x2c -> , */
+  0x1d,        /* 0x2d -> - */
+  0x1e,        /* 0x2e -> . */
+  0x1f,        /* 0x2f -> / */
+
+  0x20,        /* 0x30 -> 0 */
+  0x21,        /* 0x31 -> 1 */
+  0x22,        /* 0x32 -> 2 */
+  0x23,        /* 0x33 -> 3 */
+  0x24,        /* 0x34 -> 4 */
+  0x25,        /* 0x35 -> 5 */
+  0x26,        /* 0x36 -> 6 */
+  0x27,        /* 0x37 -> 7 */
+  0x28,        /* 0x38 -> 8 */
+  0x29,        /* 0x39 -> 9 */
+  0x2a,        /* 0x3a -> : */
+  0x2b,        /* 0x3b -> ; */
+  0x2c,        /* 0x3c -> < */
+  0x2d,        /* 0x3d -> = */
+  0x2e,        /* 0x3e -> > */
+  0x2f,        /* 0x3f -> ? */
+
+  0x30,        /* 0x40 -> @ */
+  0x31,        /* 0x41 -> A */
+  0x32,        /* 0x42 -> B */
+  0x33,        /* 0x43 -> C */
+  0x34,        /* 0x44 -> D */
+  0x35,        /* 0x45 -> E */
+  0x36,        /* 0x46 -> F */
+  0x37,        /* 0x47 -> G */
+  0x38,        /* 0x48 -> H */
+  0x39,        /* 0x49 -> I */
+  0x3a,        /* 0x4a -> J */
+  0x3b,        /* 0x4b -> K */
+  0x3c,        /* 0x4c -> L */
+  0x3d,        /* 0x4d -> M */
+  0x3e,        /* 0x4e -> N */
+  0x3f,        /* 0x4f -> O */
+
+  0x40,        /* 0x50 -> P */
+  0x41,        /* 0x51 -> Q */
+  0x42,        /* 0x52 -> R */
+  0x43,        /* 0x53 -> S */
+  0x44,        /* 0x54 -> T */
+  0x45,        /* 0x55 -> U */
+  0x46,        /* 0x56 -> V */
+  0x47,        /* 0x57 -> W */
+  0x48,        /* 0x58 -> X */
+  0x49,        /* 0x59 -> Y */
+  0x4a,        /* 0x5a -> Z */
+  0x4b,        /* 0x5b -> [ */
+  0x4c,        /* 0x5c -> \ */
+  0x4d,        /* 0x5d -> ] */
+  0x4e,        /* 0x5e -> ^ */
+  0x4f,        /* 0x5f -> _ */
+
+  0x50,        /* 0x60 -> ` */
+  0x51,        /* 0x61 -> a */
+  0x52,        /* 0x62 -> b */
+  0x53,        /* 0x63 -> c */
+  0x54,        /* 0x64 -> d */
+  0x55,        /* 0x65 -> e */
+  0x56,        /* 0x66 -> f */
+  0x57,        /* 0x67 -> g */
+  0x58,        /* 0x68 -> h */
+  0x59,        /* 0x69 -> i */
+  0x5a,        /* 0x6a -> j */
+  0x5b,        /* 0x6b -> k */
+  0x5c,        /* 0x6c -> l */
+  0x5d,        /* 0x6d -> m */
+  0x5e,        /* 0x6e -> n */
+  0x5f,        /* 0x6f -> o */
+
+  0x60,        /* 0x70 -> p */
+  0x61,        /* 0x71 -> q */
+  0x62,        /* 0x72 -> r */
+  0x63,        /* 0x73 -> s */
+  0x64,        /* 0x74 -> t */
+  0x65,        /* 0x75 -> u */
+  0x66,        /* 0x76 -> v */
+  0x67,        /* 0x77 -> w */
+  0x68,        /* 0x78 -> x */
+  0x69,        /* 0x79 -> y */
+  0x6a,        /* 0x7a -> z */
+  0x6b,        /* 0x7b -> { */
+  0x6c,        /* 0x7c -> | */
+  0x6d,        /* 0x7d -> } */
+  0x6e,        /* 0x7e -> ~ */
+  0xff,        /* 0x7f -> n/a */
+
+  0xff,        /* 0x80 -> n/a */
+  0xff,        /* 0x81 -> n/a */
+  0xff,        /* 0x82 -> n/a */
+  0xff,        /* 0x83 -> n/a */
+  0xff,        /* 0x84 -> n/a */
+  0xff,        /* 0x85 -> n/a */
+  0xff,        /* 0x86 -> n/a */
+  0xff,        /* 0x87 -> n/a */
+  0xff,        /* 0x88 -> n/a */
+  0xff,        /* 0x89 -> n/a */
+  0xff,        /* 0x8a -> n/a */
+  0xff,        /* 0x8b -> n/a */
+  0xff,        /* 0x8c -> n/a */
+  0xff,        /* 0x8d -> n/a */
+  0xff,        /* 0x8e -> n/a */
+  0xff,        /* 0x8f -> n/a */
+
+  0xff,        /* 0x90 -> n/a */
+  0xff,        /* 0x91 -> n/a */
+  0xff,        /* 0x92 -> n/a */
+  0xff,        /* 0x93 -> n/a */
+  0xff,        /* 0x94 -> n/a */
+  0xff,        /* 0x95 -> n/a */
+  0xff,        /* 0x96 -> n/a */
+  0xff,        /* 0x97 -> n/a */
+  0xff,        /* 0x98 -> n/a */
+  0xff,        /* 0x99 -> n/a */
+  0xff,        /* 0x9a -> n/a */
+  0xff,        /* 0x9b -> n/a */
+  0xff,        /* 0x9c -> n/a */
+  0xff,        /* 0x9d -> n/a */
+  0xff,        /* 0x9e -> n/a */
+  0xff,        /* 0x9f -> n/a */
+
+  0xff,        /* 0xa0 -> n/a */
+  0xff,        /* 0xa1 -> n/a */
+  0xff,        /* 0xa2 -> n/a */
+  0xff,        /* 0xa3 -> n/a */
+  0xff,        /* 0xa4 -> n/a */
+  0xff,        /* 0xa5 -> n/a */
+  0xff,        /* 0xa6 -> n/a */
+  0xff,        /* 0xa7 -> n/a */
+  0xff,        /* 0xa8 -> n/a */
+  0xff,        /* 0xa9 -> n/a */
+  0xff,        /* 0xaa -> n/a */
+  0xff,        /* 0xab -> n/a */
+  0xff,        /* 0xac -> n/a */
+  0xff,        /* 0xad -> n/a */
+  0xff,        /* 0xae -> n/a */
+  0xff,        /* 0xaf -> n/a */
+
+  0xff,        /* 0xb0 -> n/a */
+  0xff,        /* 0xb1 -> n/a */
+  0xff,        /* 0xb2 -> n/a */
+  0xff,        /* 0xb3 -> n/a */
+  0xff,        /* 0xb4 -> n/a */
+  0x05,        /* 0xb5 ->  (micro) */
+  0xff,        /* 0xb6 -> n/a */
+  0xff,        /* 0xb7 -> n/a */
+  0xff,        /* 0xb8 -> n/a */
+  0xff,        /* 0xb9 -> n/a */
+  0xff,        /* 0xba -> n/a */
+  0xff,        /* 0xbb -> n/a */
+  0xff,        /* 0xbc -> n/a */
+  0xff,        /* 0xbd -> n/a */
+  0xff,        /* 0xbe -> n/a */
+  0xff,        /* 0xbf -> n/a */
+
+  0xff,        /* 0xc0 -> n/a */
+  0xff,        /* 0xc1 -> n/a */
+  0xff,        /* 0xc2 -> n/a */
+  0xff,        /* 0xc3 -> n/a */
+  0x08,        /* 0xc4 ->  */
+  0xff,        /* 0xc5 -> n/a */
+  0xff,        /* 0xc6 -> n/a */
+  0xff,        /* 0xc7 -> n/a */
+  0xff,        /* 0xc8 -> n/a */
+  0xff,        /* 0xc9 -> n/a */
+  0xff,        /* 0xca -> n/a */
+  0xff,        /* 0xcb -> n/a */
+  0xff,        /* 0xcc -> n/a */
+  0xff,        /* 0xcd -> n/a */
+  0xff,        /* 0xce -> n/a */
+  0xff,        /* 0xcf -> n/a */
+
+  0xff,        /* 0xd0 -> n/a */
+  0xff,        /* 0xd1 -> n/a */
+  0xff,        /* 0xd2 -> n/a */
+  0xff,        /* 0xd3 -> n/a */
+  0xff,        /* 0xd4 -> n/a */
+  0xff,        /* 0xd5 -> n/a */
+  0x09,        /* 0xd6 ->  */
+  0xff,        /* 0xd7 -> n/a */
+  0xff,        /* 0xd8 -> n/a */
+  0xff,        /* 0xd9 -> n/a */
+  0xff,        /* 0xda -> n/a */
+  0xff,        /* 0xdb -> n/a */
+  0x0a,        /* 0xdc ->  */
+  0xff,        /* 0xdd -> n/a */
+  0xff,        /* 0xde -> n/a */
+  0x0b,        /* 0xdf ->  */
+
+  0xff,        /* 0xe0 -> n/a */
+  0xff,        /* 0xe1 -> n/a */
+  0xff,        /* 0xe2 -> n/a */
+  0xff,        /* 0xe3 -> n/a */
+  0x0c,        /* 0xe4 ->  */
+  0xff,        /* 0xe5 -> n/a */
+  0xff,        /* 0xe6 -> n/a */
+  0xff,        /* 0xe7 -> n/a */
+  0xff,        /* 0xe8 -> n/a */
+  0xff,        /* 0xe9 -> n/a */
+  0xff,        /* 0xea -> n/a */
+  0xff,        /* 0xeb -> n/a */
+  0xff,        /* 0xec -> n/a */
+  0xff,        /* 0xed -> n/a */
+  0xff,        /* 0xee -> n/a */
+  0xff,        /* 0xef -> n/a */
+
+  0xff,        /* 0xf0 -> n/a */
+  0xff,        /* 0xf1 -> n/a */
+  0xff,        /* 0xf2 -> n/a */
+  0xff,        /* 0xf3 -> n/a */
+  0xff,        /* 0xf4 -> n/a */
+  0xff,        /* 0xf5 -> n/a */
+  0x0d,        /* 0xf6 ->  */
+  0xff,        /* 0xf7 -> n/a */
+  0xff,        /* 0xf8 -> n/a */
+  0xff,        /* 0xf9 -> n/a */
+  0xff,        /* 0xfa -> n/a */
+  0xff,        /* 0xfb -> n/a */
+  0x0e,        /* 0xfc ->  */
+  0xff,        /* 0xfd -> n/a */
+  0xff,        /* 0xfe -> n/a */
+  0xff,        /* 0xff -> n/a */
+};
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,628 @@
+/* ************************************************************************
+ *
+ *   fixed 12x16 font based on ISO 8859-1
+ *   horizontally aligned, run-length encoded
+ *   generated by rle.py from font_12x16_hf.h, do not edit
+ *
+ *   (c) 2015-2018 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   font data
+ * ************************************************************************ */
+
+#ifdef FONT_12X16_HF
+
+
+/* font size */
+#define FONT_SIZE_X         12     /* width:  12 dots */
+#define FONT_SIZE_Y         16     /* heigth: 16 dots */
+
+/* font data format */
+#define FONT_RLE                   /* run-length encoded */
+
+
+/*
+ *  character bitmaps
+ *  - to reduce size we place some symbols and special characters at
+ *    positions 0-15, and we move the standard chars up in the list by
+ *    16 positions (using ASCII's 0-31 for control chars)
+ *  - format:
+ *    - pixel runs of alternating color, starting with
+ *      background, pixels row by row (top to down)
+ *    - nibbles, high nibble first: 15 adds 15 pixels
+ *      and continues the run, 0-14 adds the number
+ *      of pixels and ends the run
+ *    - each bitmap starts at a byte boundary
+ *    - 2048 bytes plus offset table (uncompressed 3552 bytes)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,                                                  /* 0x00 n/a */
+  0xD3,0x61,0x23,0x52,0x23,0x43,0x23,0x34,0x23,0x25,0x23,0x16,0x1F,0x91,0x31,0x62,
+  0x32,0x52,0x33,0x42,0x34,0x32,0x35,0x22,0x36,0x1D,                                   /* 0x01 symbol: diode A-C */
+  0xD3,0x61,0x23,0x52,0x23,0x43,0x23,0x34,0x23,0x25,0x23,0x16,0x1F,0x91,0x31,0x62,
+  0x32,0x52,0x33,0x42,0x34,0x32,0x35,0x22,0x36,0x1D,                                   /* 0x02 symbol: diode C-A */
+  0xD3,0x43,0x23,0x43,0x23,0x43,0x23,0x43,0x23,0x43,0x23,0x43,0x14,0x48,0x44,0x13,
+  0x43,0x23,0x43,0x23,0x43,0x23,0x43,0x23,0x43,0x23,0x43,0xD0,                         /* 0x03 symbol: capacitor */
+  0x45,0x67,0x43,0x33,0x32,0x52,0x22,0x72,0x12,0x72,0x12,0x72,0x12,0x72,0x12,0x72,
+  0x22,0x52,0x42,0x32,0x52,0x32,0x34,0x34,0x14,0x34,0xF9,                              /* 0x04 omega */
+  0xFF,0xF4,0x25,0x23,0x25,0x23,0x25,0x23,0x25,0x23,0x25,0x23,0x33,0x33,0x93,0x61,
+  0x23,0x2A,0x2A,0x2A,0x29,                                                            /* 0x05  (micro) */
+  0xFA,0xB1,0xB1,0x2A,0x2A,0x29,0x39,0x3A,0x2A,0x2A,0x2A,0xB1,0xBF,0x90,               /* 0x06 symbol: resistor left side */
+  0xF9,0xB1,0xBA,0x2A,0x2A,0x2A,0x39,0x39,0x2A,0x2A,0x21,0xB1,0xBF,0xA0,               /* 0x07 symbol: resistor right side */
+
+  0xFF,0xF5,0x24,0x25,0x22,0x27,0x49,0x29,0x47,0x22,0x25,0x24,0x2F,0xFF,0xF2,          /* 0x08  */
+  0x32,0x22,0x62,0x22,0xF3,0x65,0x83,0x34,0x32,0x26,0x22,0x26,0x22,0x26,0x22,0x26,
+  0x22,0x26,0x22,0x34,0x33,0x85,0x6F,0xC0,                                             /* 0x09  */
+  0xFC,0x22,0x26,0x22,0x2F,0x12,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,
+  0x62,0x23,0x43,0x39,0x45,0x12,0xFA,                                                  /* 0x0a  (seems to be ) */
+  0xFF,0xF7,0x47,0x22,0x25,0x24,0x24,0x24,0x24,0x75,0x23,0x34,0x24,0x24,0x24,0x24,
+  0x23,0x34,0x75,0x2A,0x28,                                                            /* 0x0b  */
+  0xFC,0x22,0x26,0x22,0x2F,0x37,0x49,0xA2,0x48,0x39,0x22,0x62,0x22,0x62,0x2A,0x39,
+  0xFA,                                                                                /* 0x0c  */
+  0xFC,0x22,0x26,0x22,0x2F,0x36,0x58,0x33,0x43,0x22,0x62,0x22,0x62,0x22,0x62,0x23,
+  0x43,0x38,0x56,0xFC,                                                                 /* 0x0d  */
+  0xFC,0x22,0x26,0x22,0x2F,0x12,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,
+  0x62,0x23,0x43,0x39,0x45,0x12,0xFA,                                                  /* 0x0e  */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,                                                  /* 0x0f n/a */
+
+  /* standard characters */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,                                                  /* 0x10 space */
+  0x52,0xA2,0x94,0x84,0x84,0x84,0x84,0x92,0xA2,0xA2,0xFF,0x42,0xA2,0xFE,               /* 0x11 ! */
+  0xFC,0x22,0x26,0x22,0x26,0x22,0x26,0x22,0x2F,0xFF,0xFF,0xFF,0xF3,                    /* 0x12 " */
+  0xF2,0x22,0x26,0x22,0x26,0x22,0x23,0xA4,0x22,0x26,0x22,0x25,0x22,0x26,0x22,0x24,
+  0x94,0x22,0x26,0x22,0x26,0x22,0x2F,0xFA,                                             /* 0x13 # */
+  0x52,0xA2,0x86,0x58,0x42,0x12,0x72,0x12,0x77,0x67,0x72,0x12,0x72,0x12,0x48,0x56,
+  0x82,0xA2,0xFE,                                                                      /* 0x14 $ */
+  0xFF,0x51,0x23,0x52,0x23,0x43,0x23,0x33,0x83,0x83,0x83,0x83,0x83,0x83,0x33,0x23,
+  0x43,0x22,0x53,0xFA,                                                                 /* 0x15 % */
+  0xF2,0x38,0x21,0x26,0x22,0x26,0x22,0x26,0x21,0x28,0x38,0x47,0x57,0x22,0x21,0x23,
+  0x22,0x44,0x23,0x25,0x31,0x45,0x42,0x2F,0xA0,                                        /* 0x16 & */
+  0x43,0x93,0x93,0xA2,0xA2,0x92,0xFF,0xFF,0xFF,0xFF,0x60,                              /* 0x17  */
+  0x63,0x82,0x93,0x92,0x93,0x93,0x93,0x93,0x93,0x93,0xA2,0xA3,0xA2,0xB3,0xFC,          /* 0x18 ( */
+  0x33,0xB2,0xA3,0xA2,0xA3,0x93,0x93,0x93,0x93,0x93,0x92,0x93,0x92,0x83,0xFF,0x00,     /* 0x19 ) */
+  0xFF,0x82,0x12,0x12,0x42,0x12,0x12,0x56,0x74,0x68,0x64,0x76,0x52,0x12,0x12,0x42,
+  0x12,0x12,0xFF,0xF5,                                                                 /* 0x1a * */
+  0xFF,0xF8,0x2A,0x2A,0x27,0x84,0x87,0x2A,0x2A,0x2F,0xFF,0x80,                         /* 0x1b + */
+  0xFF,0xFF,0xFF,0xFF,0xF1,0x39,0x39,0x3A,0x29,0x26,                                   /* 0x1c , */
+  0xFF,0xFF,0xFB,0x84,0x8F,0xFF,0xFF,0xB0,                                             /* 0x1d - */
+  0xFF,0xFF,0xFF,0xFF,0xF1,0x39,0x39,0x3F,0xE0,                                        /* 0x1e . */
+  0xF8,0x1A,0x29,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x39,0x2F,0xFF,0x00,          /* 0x1f / */
+  0x45,0x59,0x32,0x52,0x22,0x63,0x12,0x54,0x12,0x42,0x12,0x12,0x32,0x22,0x12,0x22,
+  0x32,0x12,0x12,0x42,0x14,0x52,0x13,0x62,0x22,0x52,0x39,0x55,0xFC,                    /* 0x20 0 */
+  0x62,0x93,0x75,0x75,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0x78,0x48,0xFA,          /* 0x21 1 */
+  0x37,0x49,0x23,0x53,0x12,0x72,0x12,0x63,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x8B,
+  0x1B,0xF9,                                                                           /* 0x22 2 */
+  0x37,0x49,0x23,0x53,0x12,0x72,0xA2,0x93,0x47,0x56,0xB2,0xB2,0x12,0x72,0x13,0x53,
+  0x29,0x47,0xFB,                                                                      /* 0x23 3 */
+  0x73,0x84,0x75,0x63,0x12,0x53,0x22,0x43,0x32,0x33,0x42,0x32,0x52,0x3B,0x1B,0x82,
+  0xA2,0xA2,0xA2,0xFB,                                                                 /* 0x24 4 */
+  0x1B,0x1B,0x12,0xA2,0xA2,0xA9,0x49,0xA3,0xA2,0xA2,0x12,0x72,0x13,0x53,0x29,0x47,
+  0xFB,                                                                                /* 0x25 5 */
+  0x64,0x75,0x63,0x83,0x83,0x92,0x99,0x3A,0x23,0x53,0x12,0x72,0x12,0x72,0x13,0x53,
+  0x29,0x47,0xFB,                                                                      /* 0x26 6 */
+  0x1B,0x1B,0x92,0xA2,0x92,0xA2,0x92,0xA2,0x92,0xA2,0x92,0xA2,0x92,0xA2,0xFF,0x00,     /* 0x27 7 */
+  0x45,0x67,0x43,0x33,0x32,0x52,0x32,0x52,0x33,0x33,0x47,0x49,0x23,0x53,0x12,0x72,
+  0x12,0x72,0x13,0x53,0x29,0x47,0xFB,                                                  /* 0x28 8 */
+  0x37,0x49,0x23,0x53,0x12,0x72,0x12,0x72,0x13,0x53,0x2A,0x39,0x92,0x93,0x83,0x83,
+  0x65,0x74,0xFE,                                                                      /* 0x29 9 */
+  0xFF,0xF7,0x39,0x39,0x3F,0xFF,0x03,0x93,0x93,0xFF,0xB0,                              /* 0x2a : */
+  0xFF,0xF7,0x39,0x39,0x3F,0xFF,0x03,0x93,0x93,0xA2,0xA2,0x92,0x60,                    /* 0x2b ; */
+  0x82,0x93,0x83,0x83,0x83,0x83,0x83,0x93,0xA3,0xA3,0xA3,0xA3,0xA3,0xA2,0xFB,          /* 0x2c < */
+  0xFF,0xFF,0x29,0x39,0xFC,0x93,0x9F,0xFF,0xF1,                                        /* 0x2d = */
+  0x22,0xA3,0xA3,0xA3,0xA3,0xA3,0xA3,0x93,0x83,0x83,0x83,0x83,0x83,0x92,0xFF,0x20,     /* 0x2e > */
+  0x36,0x58,0x33,0x43,0x22,0x62,0x22,0x53,0x83,0x83,0x83,0x92,0xA2,0xA2,0xF7,0x2A,
+  0x2F,0xE0,                                                                           /* 0x2f ? */
+  0x37,0x49,0x32,0x52,0x22,0x24,0x12,0x12,0x15,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+  0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x17,0x22,0x25,0x33,0xA8,
+  0x66,0xFB,                                                                           /* 0x30 @ */
+  0x52,0xA2,0x94,0x84,0x84,0x72,0x22,0x62,0x22,0x62,0x22,0x52,0x42,0x48,0x48,0x32,
+  0x62,0x22,0x62,0x22,0x62,0xFA,                                                       /* 0x31 A */
+  0x17,0x58,0x42,0x43,0x32,0x52,0x32,0x52,0x32,0x43,0x38,0x49,0x32,0x53,0x22,0x62,
+  0x22,0x62,0x22,0x53,0x29,0x38,0xFC,                                                  /* 0x32 B */
+  0x45,0x67,0x43,0x33,0x32,0x52,0x22,0xA2,0xA2,0xA2,0xA2,0xA2,0xB2,0x52,0x33,0x33,
+  0x47,0x65,0xFC,                                                                      /* 0x33 C */
+  0x17,0x58,0x42,0x43,0x32,0x52,0x32,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,
+  0x22,0x62,0x22,0x52,0x32,0x43,0x38,0x47,0xFD,                                        /* 0x34 D */
+  0x1A,0x2A,0x22,0xA2,0xA2,0xA2,0xA8,0x48,0x42,0xA2,0xA2,0xA2,0xAA,0x2A,0xFA,          /* 0x35 E */
+  0x1A,0x2A,0x22,0xA2,0xA2,0xA2,0xA8,0x48,0x42,0xA2,0xA2,0xA2,0xA2,0xA2,0xFF,0x30,     /* 0x36 F */
+  0x46,0x58,0x33,0x42,0x32,0x92,0xA2,0xA2,0x35,0x22,0x35,0x22,0x62,0x22,0x62,0x32,
+  0x52,0x33,0x42,0x48,0x57,0xFA,                                                       /* 0x37 G */
+  0x12,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x2A,0x2A,0x22,0x62,
+  0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0xFA,                              /* 0x38 H */
+  0x36,0x66,0x82,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0x86,0x66,0xFC,          /* 0x39 I */
+  0x92,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0x22,0x62,0x22,0x62,0x23,0x42,0x48,
+  0x56,0xFC,                                                                           /* 0x3a J */
+  0x12,0x62,0x22,0x53,0x22,0x43,0x32,0x33,0x42,0x23,0x52,0x13,0x65,0x75,0x72,0x13,
+  0x62,0x23,0x52,0x33,0x42,0x43,0x32,0x53,0x22,0x62,0xFA,                              /* 0x3b K */
+  0x12,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xAA,0x2A,0xFA,          /* 0x3c L */
+  0x12,0x62,0x23,0x43,0x23,0x43,0x24,0x24,0x24,0x24,0x22,0x14,0x12,0x22,0x14,0x12,
+  0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,
+  0xFA,                                                                                /* 0x3d M */
+  0x12,0x62,0x23,0x52,0x23,0x52,0x24,0x42,0x22,0x12,0x32,0x22,0x12,0x32,0x22,0x22,
+  0x22,0x22,0x22,0x22,0x22,0x32,0x12,0x22,0x32,0x12,0x22,0x44,0x22,0x53,0x22,0x53,
+  0x22,0x62,0xFA,                                                                      /* 0x3e N */
+  0x44,0x76,0x53,0x23,0x42,0x42,0x32,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,
+  0x22,0x62,0x32,0x42,0x43,0x23,0x56,0x74,0xFD,                                        /* 0x3f O */
+  0x18,0x49,0x32,0x53,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x53,0x29,0x38,0x42,0xA2,
+  0xA2,0xA2,0xA2,0xFF,0x30,                                                            /* 0x40 P */
+  0x44,0x76,0x53,0x23,0x42,0x42,0x32,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,
+  0x22,0x32,0x12,0x32,0x24,0x43,0x23,0x58,0x54,0x12,0xFA,                              /* 0x41 Q */
+  0x18,0x49,0x32,0x53,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x53,0x29,0x38,0x42,0x23,
+  0x52,0x33,0x42,0x43,0x32,0x53,0x22,0x62,0xFA,                                        /* 0x42 R */
+  0x36,0x58,0x33,0x43,0x22,0x62,0x22,0xA3,0xA7,0x67,0xA3,0xA2,0x22,0x62,0x23,0x43,
+  0x38,0x56,0xFC,                                                                      /* 0x43 S */
+  0x28,0x48,0x72,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xFE,          /* 0x44 T */
+  0x12,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,
+  0x22,0x62,0x22,0x62,0x22,0x62,0x32,0x42,0x48,0x56,0xFC,                              /* 0x45 U */
+  0x12,0x62,0x22,0x62,0x22,0x62,0x32,0x42,0x42,0x42,0x42,0x42,0x52,0x22,0x62,0x22,
+  0x62,0x22,0x74,0x84,0x84,0x92,0xA2,0xFE,                                             /* 0x46 V */
+  0x12,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x22,
+  0x22,0x22,0x22,0x22,0x22,0x14,0x12,0x24,0x24,0x23,0x43,0x23,0x43,0x22,0x62,0xFA,     /* 0x47 W */
+  0x12,0x62,0x22,0x62,0x32,0x42,0x42,0x42,0x52,0x22,0x74,0x92,0xA2,0x94,0x72,0x22,
+  0x52,0x42,0x42,0x42,0x32,0x62,0x22,0x62,0xFA,                                        /* 0x48 X */
+  0x12,0x62,0x22,0x62,0x32,0x42,0x42,0x42,0x52,0x22,0x62,0x22,0x74,0x84,0x92,0xA2,
+  0xA2,0xA2,0xA2,0xA2,0xFE,                                                            /* 0x49 Y */
+  0x1A,0x2A,0x92,0xA2,0x92,0x92,0x92,0xA2,0x92,0x92,0x92,0xA2,0x9A,0x2A,0xFA,          /* 0x4a Z */
+  0x36,0x66,0x62,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA6,0x66,0xFC,          /* 0x4b [ */
+  0xD1,0xB2,0xA3,0xA3,0xA3,0xA3,0xA3,0xA3,0xA3,0xA3,0xA3,0xA2,0xFF,0x60,               /* 0x4c \ */
+  0x36,0x66,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0x66,0x66,0xFC,          /* 0x4d ] */
+  0x61,0xA3,0x85,0x63,0x13,0x43,0x33,0x23,0x53,0x12,0x72,0xFF,0xFF,0xFF,0xF3,          /* 0x4e ^ */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xB1,0xB0,                                             /* 0x4f _ */
+  0xF2,0x39,0x39,0x39,0x2A,0x2B,0x2F,0xFF,0xFF,0xFF,0x70,                              /* 0x50 ` */
+  0xFF,0xFF,0x37,0x49,0xA2,0x48,0x39,0x22,0x62,0x22,0x62,0x2A,0x39,0xFA,               /* 0x51 a */
+  0x12,0xA2,0xA2,0xA2,0xA2,0xA2,0x15,0x49,0x33,0x43,0x22,0x62,0x22,0x62,0x22,0x62,
+  0x22,0x53,0x29,0x38,0xFC,                                                            /* 0x52 b */
+  0xFF,0xFF,0x36,0x58,0x33,0x52,0x22,0xA2,0xA2,0xA3,0x52,0x38,0x56,0xFC,               /* 0x53 c */
+  0x92,0xA2,0xA2,0xA2,0xA2,0x45,0x12,0x39,0x23,0x34,0x22,0x62,0x22,0x62,0x22,0x62,
+  0x23,0x52,0x39,0x48,0xFA,                                                            /* 0x54 d */
+  0xFF,0xFF,0x36,0x58,0x33,0x52,0x2A,0x29,0x32,0xA3,0xA8,0x56,0xFC,                    /* 0x55 e */
+  0x54,0x75,0x63,0x92,0xA2,0xA2,0x87,0x57,0x72,0xA2,0xA2,0xA2,0xA2,0xA2,0xFF,0x10,     /* 0x56 f */
+  0xFF,0xFF,0x38,0x39,0x23,0x52,0x22,0x62,0x23,0x43,0x39,0x45,0x12,0xA2,0x93,0x38,
+  0x47,0x30,                                                                           /* 0x57 g */
+  0x12,0xA2,0xA2,0xA2,0xA2,0xA2,0x14,0x58,0x43,0x33,0x32,0x52,0x32,0x52,0x32,0x52,
+  0x32,0x52,0x32,0x52,0x32,0x52,0xFB,                                                  /* 0x58 h */
+  0xFE,0x2A,0x2F,0x63,0x93,0xA2,0xA2,0xA2,0xA2,0xA2,0x86,0x66,0xFC,                    /* 0x59 i */
+  0xFF,0x12,0xA2,0xF6,0x39,0x3A,0x2A,0x2A,0x2A,0x2A,0x2A,0x26,0x22,0x26,0x67,0x44,     /* 0x5a j */
+  0x22,0xA2,0xA2,0xA2,0xA2,0xA2,0x32,0x52,0x23,0x52,0x13,0x65,0x75,0x72,0x13,0x62,
+  0x23,0x52,0x33,0x42,0x42,0xFB,                                                       /* 0x5b k */
+  0x43,0x93,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0xA2,0x86,0x66,0xFC,          /* 0x5c l */
+  0xFF,0xFF,0x11,0x12,0x22,0x49,0x3A,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+  0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0xFA,                                   /* 0x5d m */
+  0xFF,0xFF,0x27,0x58,0x42,0x43,0x32,0x52,0x32,0x52,0x32,0x52,0x32,0x52,0x32,0x52,
+  0x32,0x52,0xFA,                                                                      /* 0x5e n */
+  0xFF,0xFF,0x36,0x58,0x33,0x43,0x22,0x62,0x22,0x62,0x22,0x62,0x23,0x43,0x38,0x56,
+  0xFC,                                                                                /* 0x5f o */
+  0xFF,0xFF,0x18,0x49,0x32,0x53,0x22,0x62,0x22,0x62,0x23,0x43,0x29,0x32,0x15,0x42,
+  0xA2,0xA2,0x90,                                                                      /* 0x60 p */
+  0xFF,0xFF,0x38,0x39,0x23,0x52,0x22,0x62,0x22,0x62,0x23,0x43,0x39,0x45,0x12,0xA2,
+  0xA2,0xA2,0x10,                                                                      /* 0x61 q */
+  0xFF,0xFF,0x22,0x15,0x49,0x33,0x42,0x32,0xA2,0xA2,0xA2,0xA2,0xA2,0xFF,0x20,          /* 0x62 r */
+  0xFF,0xFF,0x26,0x58,0x42,0xA7,0x67,0xA2,0xA2,0x48,0x56,0xFD,                         /* 0x63 s */
+  0xF0,0x2A,0x2A,0x2A,0x28,0x75,0x77,0x2A,0x2A,0x2A,0x2A,0x2A,0x67,0x5F,0xC0,          /* 0x64 t */
+  0xFF,0xFF,0x12,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x22,0x62,0x23,0x43,
+  0x39,0x45,0x12,0xFA,                                                                 /* 0x65 u */
+  0xFF,0xFF,0x12,0x62,0x22,0x62,0x32,0x42,0x42,0x42,0x52,0x22,0x62,0x22,0x74,0x84,
+  0x92,0xFE,                                                                           /* 0x66 v */
+  0xFF,0xFF,0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+  0x22,0x22,0x14,0x12,0x38,0x43,0x23,0x51,0x41,0xFC,                                   /* 0x67 w */
+  0xFF,0xFF,0x12,0x52,0x33,0x33,0x43,0x13,0x65,0x83,0x85,0x63,0x13,0x43,0x33,0x32,
+  0x52,0xFB,                                                                           /* 0x68 x */
+  0xFF,0xFF,0x22,0x42,0x42,0x42,0x52,0x22,0x62,0x22,0x74,0x84,0x92,0xA2,0x92,0xA2,
+  0x92,0x70,                                                                           /* 0x69 y */
+  0xFF,0xFF,0x19,0x38,0x92,0x92,0x92,0x92,0x92,0x99,0x39,0xFB,                         /* 0x6a z */
+  0x64,0x75,0x63,0x92,0xA2,0xA2,0x93,0x83,0xA3,0xA2,0xA2,0xA2,0xA3,0xA5,0x84,0xE0,     /* 0x6b { */
+  0x52,0xA2,0xA2,0xA2,0xA2,0xA2,0xF7,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2F,0xE0,          /* 0x6c | */
+  0x24,0x85,0xA3,0xA2,0xA2,0xA2,0xA3,0xA3,0x83,0x92,0xA2,0xA2,0x93,0x65,0x74,0xF3,     /* 0x6d } */
+  0xFC,0x33,0x23,0x21,0x21,0x23,0x23,0x3F,0xFF,0xFF,0xFF,0xFF,0x00                     /* 0x6e ~ */
+};
+
+
+/* start of bitmaps in FontData */
+const uint16_t FontIndex[] PROGMEM = {
+  /* symbols and special characters */
+  0,        /* 0x00 n/a */
+  7,        /* 0x01 symbol: diode A-C */
+  33,       /* 0x02 symbol: diode C-A */
+  59,       /* 0x03 symbol: capacitor */
+  87,       /* 0x04 omega */
+  114,      /* 0x05  (micro) */
+  135,      /* 0x06 symbol: resistor left side */
+  149,      /* 0x07 symbol: resistor right side */
+  163,      /* 0x08  */
+  178,      /* 0x09  */
+  202,      /* 0x0a  (seems to be ) */
+  225,      /* 0x0b  */
+  246,      /* 0x0c  */
+  263,      /* 0x0d  */
+  283,      /* 0x0e  */
+  306,      /* 0x0f n/a */
+  /* standard characters */
+  313,      /* 0x10 space */
+  320,      /* 0x11 ! */
+  334,      /* 0x12 " */
+  347,      /* 0x13 # */
+  371,      /* 0x14 $ */
+  390,      /* 0x15 % */
+  410,      /* 0x16 & */
+  435,      /* 0x17  */
+  446,      /* 0x18 ( */
+  461,      /* 0x19 ) */
+  477,      /* 0x1a * */
+  497,      /* 0x1b + */
+  509,      /* 0x1c , */
+  519,      /* 0x1d - */
+  527,      /* 0x1e . */
+  536,      /* 0x1f / */
+  551,      /* 0x20 0 */
+  580,      /* 0x21 1 */
+  595,      /* 0x22 2 */
+  613,      /* 0x23 3 */
+  632,      /* 0x24 4 */
+  652,      /* 0x25 5 */
+  669,      /* 0x26 6 */
+  688,      /* 0x27 7 */
+  704,      /* 0x28 8 */
+  727,      /* 0x29 9 */
+  746,      /* 0x2a : */
+  757,      /* 0x2b ; */
+  770,      /* 0x2c < */
+  785,      /* 0x2d = */
+  794,      /* 0x2e > */
+  810,      /* 0x2f ? */
+  828,      /* 0x30 @ */
+  862,      /* 0x31 A */
+  884,      /* 0x32 B */
+  907,      /* 0x33 C */
+  926,      /* 0x34 D */
+  951,      /* 0x35 E */
+  966,      /* 0x36 F */
+  982,      /* 0x37 G */
+  1004,     /* 0x38 H */
+  1031,     /* 0x39 I */
+  1046,     /* 0x3a J */
+  1064,     /* 0x3b K */
+  1091,     /* 0x3c L */
+  1106,     /* 0x3d M */
+  1139,     /* 0x3e N */
+  1174,     /* 0x3f O */
+  1199,     /* 0x40 P */
+  1220,     /* 0x41 Q */
+  1247,     /* 0x42 R */
+  1272,     /* 0x43 S */
+  1291,     /* 0x44 T */
+  1306,     /* 0x45 U */
+  1333,     /* 0x46 V */
+  1357,     /* 0x47 W */
+  1389,     /* 0x48 X */
+  1414,     /* 0x49 Y */
+  1435,     /* 0x4a Z */
+  1450,     /* 0x4b [ */
+  1465,     /* 0x4c \ */
+  1479,     /* 0x4d ] */
+  1494,     /* 0x4e ^ */
+  1509,     /* 0x4f _ */
+  1517,     /* 0x50 ` */
+  1528,     /* 0x51 a */
+  1542,     /* 0x52 b */
+  1563,     /* 0x53 c */
+  1577,     /* 0x54 d */
+  1598,     /* 0x55 e */
+  1611,     /* 0x56 f */
+  1627,     /* 0x57 g */
+  1645,     /* 0x58 h */
+  1668,     /* 0x59 i */
+  1681,     /* 0x5a j */
+  1697,     /* 0x5b k */
+  1719,     /* 0x5c l */
+  1734,     /* 0x5d m */
+  1760,     /* 0x5e n */
+  1779,     /* 0x5f o */
+  1796,     /* 0x60 p */
+  1815,     /* 0x61 q */
+  1834,     /* 0x62 r */
+  1849,     /* 0x63 s */
+  1861,     /* 0x64 t */
+  1876,     /* 0x65 u */
+  1896,     /* 0x66 v */
+  1914,     /* 0x67 w */
+  1940,     /* 0x68 x */
+  1958,     /* 0x69 y */
+  1976,     /* 0x6a z */
+  1988,     /* 0x6b { */
+  2004,     /* 0x6c | */
+  2019,     /* 0x6d } */
+  2035      /* 0x6e ~ */
+};
+
+
+/*
+ *  font lookup table for ISO 8859-1
+ *  - 8 bit ISO 8859-1 to custom font
+ *  - ff: no bitmap available
+ */
+
+const uint8_t FontTable[] PROGMEM = {
+  0xff,        /* 0x00 -> n/a */
+  0x01,        /* 0x01 -> symbol: diode A-C */
+  0x02,        /* 0x02 -> symbol: diode C-A */
+  0x03,        /* 0x03 -> symbol: capacitor */
+  0x04,        /* 0x04 -> omega */
+  0x05,        /* 0x05 ->  (micro) */
+  0x06,        /* 0x06 -> symbol: resistor left side */
+  0x07,        /* 0x07 -> symbol: resistor right side */
+  0xff,        /* 0x08 -> n/a */
+  0xff,        /* 0x09 -> n/a */
+  0xff,        /* 0x0a -> n/a */
+  0xff,        /* 0x0b -> n/a */
+  0xff,        /* 0x0c -> n/a */
+  0xff,        /* 0x0d -> n/a */
+  0xff,        /* 0x0e -> n/a */
+  0xff,        /* 0x0f -> n/a */
+
+  0xff,        /* 0x10 -> n/a */
+  0xff,        /* 0x11 -> n/a */
+  0xff,        /* 0x12 -> n/a */
+  0xff,        /* 0x13 -> n/a */
+  0xff,        /* 0x14 -> n/a */
+  0xff,        /* 0x15 -> n/a */
+  0xff,        /* 0x16 -> n/a */
+  0xff,        /* 0x17 -> n/a */
+  0xff,        /* 0x18 -> n/a */
+  0xff,        /* 0x19 -> n/a */
+  0xff,        /* 0x1a -> n/a */
+  0xff,        /* 0x1b -> n/a */
+  0xff,        /* 0x1c -> n/a */
+  0xff,        /* 0x1d -> n/a */
+  0xff,        /* 0x1e -> n/a */
+  0xff,        /* 0x1f -> n/a */
+
+  0x10,        /* 0x20 -> space */
+  0x11,        /* 0x21 -> ! */
+  0x12,        /* 0x22 -> " */
+  0x13,        /* 0x23 -> # */
+  0x14,        /* 0x24 -> $ */
+  0x15,        /* 0x25 -> % */
+  0x16,        /* 0x26 -> & */
+  0x17,        /* 0x27 ->  */
+  0x18,        /* 0x28 -> ( */
+  0x19,        /* 0x29 -> ) */
+  0x1a,        /* 0x2a -> * */
+  0x1b,        /* 0x2b -> + */
+  0x1c,        /* 0x2c -> , */
+  0x1d,        /* 0x2d -> - */
+  0x1e,        /* 0x2e -> . */
+  0x1f,        /* 0x2f -> / */
+
+  0x20,        /* 0x30 -> 0 */
+  0x21,        /* 0x31 -> 1 */
+  0x22,        /* 0x32 -> 2 */
+  0x23,        /* 0x33 -> 3 */
+  0x24,        /* 0x34 -> 4 */
+  0x25,        /* 0x35 -> 5 */
+  0x26,        /* 0x36 -> 6 */
+  0x27,        /* 0x37 -> 7 */
+  0x28,        /* 0x38 -> 8 */
+  0x29,        /* 0x39 -> 9 */
+  0x2a,        /* 0x3a -> : */
+  0x2b,        /* 0x3b -> ; */
+  0x2c,        /* 0x3c -> < */
+  0x2d,        /* 0x3d -> = */
+  0x2e,        /* 0x3e -> > */
+  0x2f,        /* 0x3f -> ? */
+
+  0x30,        /* 0x40 -> @ */
+  0x31,        /* 0x41 -> A */
+  0x32,        /* 0x42 -> B */
+  0x33,        /* 0x43 -> C */
+  0x34,        /* 0x44 -> D */
+  0x35,        /* 0x45 -> E */
+  0x36,        /* 0x46 -> F */
+  0x37,        /* 0x47 -> G */
+  0x38,        /* 0x48 -> H */
+  0x39,        /* 0x49 -> I */
+  0x3a,        /* 0x4a -> J */
+  0x3b,        /* 0x4b -> K */
+  0x3c,        /* 0x4c -> L */
+  0x3d,        /* 0x4d -> M */
+  0x3e,        /* 0x4e -> N */
+  0x3f,        /* 0x4f -> O */
+
+  0x40,        /* 0x50 -> P */
+  0x41,        /* 0x51 -> Q */
+  0x42,        /* 0x52 -> R */
+  0x43,        /* 0x53 -> S */
+  0x44,        /* 0x54 -> T */
+  0x45,        /* 0x55 -> U */
+  0x46,        /* 0x56 -> V */
+  0x47,        /* 0x57 -> W */
+  0x48,        /* 0x58 -> X */
+  0x49,        /* 0x59 -> Y */
+  0x4a,        /* 0x5a -> Z */
+  0x4b,        /* 0x5b -> [ */
+  0x4c,        /* 0x5c -> \ */
+  0x4d,        /* 0x5d -> ] */
+  0x4e,        /* 0x5e -> ^ */
+  0x4f,        /* 0x5f -> _ */
+
+  0x50,        /* 0x60 -> ` */
+  0x51,        /* 0x61 -> a */
+  0x52,        /* 0x62 -> b */
+  0x53,        /* 0x63 -> c */
+  0x54,        /* 0x64 -> d */
+  0x55,        /* 0x65 -> e */
+  0x56,        /* 0x66 -> f */
+  0x57,        /* 0x67 -> g */
+  0x58,        /* 0x68 -> h */
+  0x59,        /* 0x69 -> i */
+  0x5a,        /* 0x6a -> j */
+  0x5b,        /* 0x6b -> k */
+  0x5c,        /* 0x6c -> l */
+  0x5d,        /* 0x6d -> m */
+  0x5e,        /* 0x6e -> n */
+  0x5f,        /* 0x6f -> o */
+
+  0x60,        /* 0x70 -> p */
+  0x61,        /* 0x71 -> q */
+  0x62,        /* 0x72 -> r */
+  0x63,        /* 0x73 -> s */
+  0x64,        /* 0x74 -> t */
+  0x65,        /* 0x75 -> u */
+  0x66,        /* 0x76 -> v */
+  0x67,        /* 0x77 -> w */
+  0x68,        /* 0x78 -> x */
+  0x69,        /* 0x79 -> y */
+  0x6a,        /* 0x7a -> z */
+  0x6b,        /* 0x7b -> { */
+  0x6c,        /* 0x7c -> | */
+  0x6d,        /* 0x7d -> } */
+  0x6e,        /* 0x7e -> ~ */
+  0xff,        /* 0x7f -> n/a */
+
+  0xff,        /* 0x80 -> n/a */
+  0xff,        /* 0x81 -> n/a */
+  0xff,        /* 0x82 -> n/a */
+  0xff,        /* 0x83 -> n/a */
+  0xff,        /* 0x84 -> n/a */
+  0xff,        /* 0x85 -> n/a */
+  0xff,        /* 0x86 -> n/a */
+  0xff,        /* 0x87 -> n/a */
+  0xff,        /* 0x88 -> n/a */
+  0xff,        /* 0x89 -> n/a */
+  0xff,        /* 0x8a -> n/a */
+  0xff,        /* 0x8b -> n/a */
+  0xff,        /* 0x8c -> n/a */
+  0xff,        /* 0x8d -> n/a */
+  0xff,        /* 0x8e -> n/a */
+  0xff,        /* 0x8f -> n/a */
+
+  0xff,        /* 0x90 -> n/a */
+  0xff,        /* 0x91 -> n/a */
+  0xff,        /* 0x92 -> n/a */
+  0xff,        /* 0x93 -> n/a */
+  0xff,        /* 0x94 -> n/a */
+  0xff,        /* 0x95 -> n/a */
+  0xff,        /* 0x96 -> n/a */
+  0xff,        /* 0x97 -> n/a */
+  0xff,        /* 0x98 -> n/a */
+  0xff,        /* 0x99 -> n/a */
+  0xff,        /* 0x9a -> n/a */
+  0xff,        /* 0x9b -> n/a */
+  0xff,        /* 0x9c -> n/a */
+  0xff,        /* 0x9d -> n/a */
+  0xff,        /* 0x9e -> n/a */
+  0xff,        /* 0x9f -> n/a */
+
+  0xff,        /* 0xa0 -> n/a */
+  0xff,        /* 0xa1 -> n/a */
+  0xff,        /* 0xa2 -> n/a */
+  0xff,        /* 0xa3 -> n/a */
+  0xff,        /* 0xa4 -> n/a */
+  0xff,        /* 0xa5 -> n/a */
+  0xff,        /* 0xa6 -> n/a */
+  0xff,        /* 0xa7 -> n/a */
+  0xff,        /* 0xa8 -> n/a */
+  0xff,        /* 0xa9 -> n/a */
+  0xff,        /* 0xaa -> n/a */
+  0xff,        /* 0xab -> n/a */
+  0xff,        /* 0xac -> n/a */
+  0xff,        /* 0xad -> n/a */
+  0xff,        /* 0xae -> n/a */
+  0xff,        /* 0xaf -> n/a */
+
+  0xff,        /* 0xb0 -> n/a */
+  0xff,        /* 0xb1 -> n/a */
+  0xff,        /* 0xb2 -> n/a */
+  0xff,        /* 0xb3 -> n/a */
+  0xff,        /* 0xb4 -> n/a */
+  0x05,        /* 0xb5 ->  (micro) */
+  0xff,        /* 0xb6 -> n/a */
+  0xff,        /* 0xb7 -> n/a */
+  0xff,        /* 0xb8 -> n/a */
+  0xff,        /* 0xb9 -> n/a */
+  0xff,        /* 0xba -> n/a */
+  0xff,        /* 0xbb -> n/a */
+  0xff,        /* 0xbc -> n/a */
+  0xff,        /* 0xbd -> n/a */
+  0xff,        /* 0xbe -> n/a */
+  0xff,        /* 0xbf -> n/a */
+
+  0xff,        /* 0xc0 -> n/a */
+  0xff,        /* 0xc1 -> n/a */
+  0xff,        /* 0xc2 -> n/a */
+  0xff,        /* 0xc3 -> n/a */
+  0x08,        /* 0xc4 ->  */
+  0xff,        /* 0xc5 -> n/a */
+  0xff,        /* 0xc6 -> n/a */
+  0xff,        /* 0xc7 -> n/a */
+  0xff,        /* 0xc8 -> n/a */
+  0xff,        /* 0xc9 -> n/a */
+  0xff,        /* 0xca -> n/a */
+  0xff,        /* 0xcb -> n/a */
+  0xff,        /* 0xcc -> n/a */
+  0xff,        /* 0xcd -> n/a */
+  0xff,        /* 0xce -> n/a */
+  0xff,        /* 0xcf -> n/a */
+
+  0xff,        /* 0xd0 -> n/a */
+  0xff,        /* 0xd1 -> n/a */
+  0xff,        /* 0xd2 -> n/a */
+  0xff,        /* 0xd3 -> n/a */
+  0xff,        /* 0xd4 -> n/a */
+  0xff,        /* 0xd5 -> n/a */
+  0x09,        /* 0xd6 ->  */
+  0xff,        /* 0xd7 -> n/a */
+  0xff,        /* 0xd8 -> n/a */
+  0xff,        /* 0xd9 -> n/a */
+  0xff,        /* 0xda -> n/a */
+  0xff,        /* 0xdb -> n/a */
+  0x0a,        /* 0xdc ->  */
+  0xff,        /* 0xdd -> n/a */
+  0xff,        /* 0xde -> n/a */
+  0x0b,        /* 0xdf ->  */
+
+  0xff,        /* 0xe0 -> n/a */
+  0xff,        /* 0xe1 -> n/a */
+  0xff,        /* 0xe2 -> n/a */
+  0xff,        /* 0xe3 -> n/a */
+  0x0c,        /* 0xe4 ->  */
+  0xff,        /* 0xe5 -> n/a */
+  0xff,        /* 0xe6 -> n/a */
+  0xff,        /* 0xe7 -> n/a */
+  0xff,        /* 0xe8 -> n/a */
+  0xff,        /* 0xe9 -> n/a */
+  0xff,        /* 0xea -> n/a */
+  0xff,        /* 0xeb -> n/a */
+  0xff,        /* 0xec -> n/a */
+  0xff,        /* 0xed -> n/a */
+  0xff,        /* 0xee -> n/a */
+  0xff,        /* 0xef -> n/a */
+
+  0xff,        /* 0xf0 -> n/a */
+  0xff,        /* 0xf1 -> n/a */
+  0xff,        /* 0xf2 -> n/a */
+  0xff,        /* 0xf3 -> n/a */
+  0xff,        /* 0xf4 -> n/a */
+  0xff,        /* 0xf5 -> n/a */
+  0x0d,        /* 0xf6 ->  */
+  0xff,        /* 0xf7 -> n/a */
+  0xff,        /* 0xf8 -> n/a */
+  0xff,        /* 0xf9 -> n/a */
+  0xff,        /* 0xfa -> n/a */
+  0xff,        /* 0xfb -> n/a */
+  0x0e,        /* 0xfc ->  */
+  0xff,        /* 0xfd -> n/a */
+  0xff,        /* 0xfe -> n/a */
+  0xff,        /* 0xff -> n/a */
+};
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
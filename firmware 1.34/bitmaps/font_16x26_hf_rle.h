@@ -0,0 +1,714 @@
+/* ************************************************************************
+ *
+ *   fixed 16x26 font based on ISO 8859-1
+ *   horizontally aligned, run-length encoded
+ *   generated by rle.py from font_16x26_hf.h, do not edit
+ *
+ *   (c) 2015-2018 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   font data
+ * ************************************************************************ */
+
+#ifdef FONT_16X26_HF
+
+
+/* font size */
+#define FONT_SIZE_X         16     /* width:  16 dots */
+#define FONT_SIZE_Y         26     /* heigth: 26 dots */
+
+/* font data format */
+#define FONT_RLE                   /* run-length encoded */
+
+
+/*
+ *  character bitmaps
+ *  - to reduce size we place some symbols and special characters at
+ *    positions 0-15, and we move the standard chars up in the list by
+ *    16 positions (using ASCII's 0-31 for control chars)
+ *  - format:
+ *    - pixel runs of alternating color, starting with
+ *      background, pixels row by row (top to down)
+ *    - nibbles, high nibble first: 15 adds 15 pixels
+ *      and continues the run, 0-14 adds the number
+ *      of pixels and ends the run
+ *    - each bitmap starts at a byte boundary
+ *    - 3302 bytes plus offset table (uncompressed 5772 bytes)
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  /* symbols and special characters */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,               /* 0x00 n/a */
+  0xFF,0xF5,0x19,0x33,0x28,0x33,0x37,0x33,0x46,0x33,0x55,0x33,0x64,0x33,0x73,0x33,
+  0x82,0x33,0x91,0x31,0xFF,0x22,0x91,0x33,0x82,0x33,0x73,0x33,0x64,0x33,0x55,0x33,
+  0x46,0x33,0x37,0x33,0x28,0x33,0x19,0x3F,0xFF,0x40,                                   /* 0x01 symbol: diode A-C */
+  0xFF,0xF4,0x39,0x13,0x38,0x23,0x37,0x33,0x36,0x43,0x35,0x53,0x34,0x63,0x33,0x73,
+  0x32,0x83,0x31,0x92,0xFF,0x21,0x31,0x93,0x32,0x83,0x33,0x73,0x34,0x63,0x35,0x53,
+  0x36,0x43,0x37,0x33,0x38,0x23,0x39,0x1F,0xFF,0x50,                                   /* 0x02 symbol: diode C-A */
+  0xFF,0xF5,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,
+  0x44,0x44,0x44,0x42,0x64,0xC4,0x62,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,
+  0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x4F,0xFF,0x50,                              /* 0x03 symbol: capacitor */
+  0xFF,0xF9,0x5A,0x78,0x25,0x26,0x27,0x24,0x29,0x23,0x29,0x22,0x2B,0x21,0x2B,0x21,
+  0x2B,0x21,0x2B,0x22,0x29,0x23,0x29,0x24,0x27,0x26,0x25,0x28,0x23,0x25,0x13,0x23,
+  0x23,0x11,0x63,0x61,0x63,0x6F,0xFF,0xFF,0x50,                                        /* 0x04 omega */
+  0xFF,0xFF,0xFF,0xF9,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,
+  0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x44,0x44,0x52,0x54,0x81,0x34,0x31,0x41,
+  0x43,0x3D,0x3D,0x3D,0x3D,0x3B,                                                       /* 0x05  (micro) */
+  0xFF,0xFF,0xF6,0xF0,0x1F,0x01,0x2E,0x2E,0x2E,0x2E,0x2D,0x3D,0x3E,0x2E,0x2E,0x2E,
+  0x2E,0x2E,0xF0,0x1F,0x0F,0xFF,0xFF,0x50,                                             /* 0x06 symbol: resistor left side */
+  0xFF,0xFF,0xF5,0xF0,0x1F,0x0E,0x2E,0x2E,0x2E,0x2E,0x2E,0x3D,0x3D,0x2E,0x2E,0x2E,
+  0x2E,0x21,0xF0,0x1F,0x0F,0xFF,0xFF,0x60,                                             /* 0x07 symbol: resistor right side */
+
+  0x42,0x42,0x82,0x42,0xFF,0xFD,0x3D,0x4B,0x5B,0x21,0x3A,0x21,0x39,0x32,0x29,0x23,
+  0x37,0x33,0x37,0x34,0x36,0x25,0x35,0xC4,0xC3,0x37,0x33,0x38,0x32,0x38,0x31,0x3A,
+  0x3F,0xFF,0xFF,0x50,                                                                 /* 0x08  */
+  0x42,0x42,0x82,0x42,0xFF,0xFC,0x69,0x87,0x34,0x35,0x36,0x34,0x36,0x33,0x38,0x32,
+  0x38,0x32,0x38,0x32,0x38,0x32,0x38,0x32,0x38,0x33,0x36,0x34,0x36,0x35,0x34,0x37,
+  0x89,0x6F,0xFF,0xFF,0xA0,                                                            /* 0x09  */
+  0x52,0x42,0x82,0x42,0xFF,0xF8,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,
+  0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x45,0x44,
+  0x35,0x36,0x98,0x7F,0xFF,0xFF,0x90,                                                  /* 0x0a  */
+  0xF5,0x69,0x87,0x43,0x36,0x34,0x36,0x34,0x36,0x34,0x27,0x33,0x37,0x32,0x38,0x32,
+  0x38,0x32,0x38,0x32,0x47,0x33,0x46,0x34,0x45,0x35,0x44,0x36,0x43,0x37,0x33,0x37,
+  0x33,0x32,0x14,0x33,0x32,0x74,0x33,0x5F,0xFF,0xFF,0x80,                              /* 0x0b  */
+  0xFF,0xF8,0x23,0x29,0x23,0x2F,0xFB,0x68,0x97,0x24,0x4D,0x3D,0x38,0x87,0x96,0x34,
+  0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x43,0x46,0x71,0x45,0x43,0x4F,0xFF,0xFF,0x60,     /* 0x0c  */
+  0xFF,0xF7,0x23,0x29,0x23,0x2F,0xFC,0x59,0x96,0x43,0x45,0x35,0x34,0x37,0x33,0x37,
+  0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x34,0x35,0x35,0x43,0x46,0x99,0x5F,0xFF,
+  0xFF,0xB0,                                                                           /* 0x0d  */
+  0xFF,0xF7,0x23,0x29,0x23,0x2F,0xF9,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,
+  0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x35,0x44,0x43,0x55,0x71,
+  0x36,0x43,0x3F,0xFF,0xFF,0x70,                                                       /* 0x0e  */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,               /* 0x0f n/a */
+
+  /* standard characters */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,               /* 0x10 space */
+  0xFF,0x93,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xFF,
+  0xF0,0x3D,0x3D,0x3F,0xFF,0xFF,0xB0,                                                  /* 0x11 ! */
+  0xF4,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x38,0x15,0x19,0x15,0x1F,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,                                        /* 0x12 " */
+  0xFF,0x92,0x32,0x92,0x32,0x82,0x32,0x92,0x32,0x92,0x32,0x92,0x32,0x5D,0x3D,0x62,
+  0x32,0x92,0x22,0x92,0x32,0x6D,0x3D,0x52,0x32,0x92,0x32,0x92,0x32,0x92,0x32,0x82,
+  0x32,0x92,0x32,0xFF,0xFF,0xFC,                                                       /* 0x13 # */
+  0x82,0xE2,0xC7,0x7A,0x63,0x12,0x31,0x53,0x22,0x93,0x22,0x93,0x22,0x94,0x12,0xA6,
+  0xB5,0xD4,0xD5,0xB5,0xB2,0x13,0xA2,0x13,0xA2,0x13,0xA2,0x13,0x52,0x32,0x12,0x6A,
+  0x87,0xC2,0xE2,0xFF,0xF9,                                                            /* 0x14 $ */
+  0xFF,0x44,0x82,0x12,0x22,0x62,0x12,0x42,0x42,0x22,0x42,0x32,0x32,0x42,0x32,0x32,
+  0x42,0x22,0x42,0x42,0x12,0x62,0x22,0x12,0x84,0x22,0xD2,0xD2,0x24,0x82,0x12,0x22,
+  0x62,0x12,0x42,0x42,0x22,0x42,0x32,0x32,0x42,0x32,0x32,0x42,0x22,0x42,0x42,0x12,
+  0x62,0x22,0x12,0x84,0xFF,0xFF,0xF7,                                                  /* 0x15 % */
+  0xFF,0x75,0xA7,0x83,0x33,0x73,0x33,0x73,0x33,0x73,0x32,0x93,0x13,0x95,0xA5,0xA6,
+  0x53,0x13,0x23,0x46,0x34,0x36,0x43,0x32,0x13,0x53,0x22,0x13,0x66,0x14,0x55,0x34,
+  0x54,0x4D,0x56,0x24,0xFF,0xFF,0xF5,                                                  /* 0x16 & */
+  0xF7,0x3D,0x3D,0x3D,0x3D,0x3E,0x1F,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFB,                                                                           /* 0x17  */
+  0xFC,0x2C,0x4B,0x4B,0x3C,0x3C,0x3D,0x3D,0x3C,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3E,0x3D,0x3D,0x3E,0x3E,0x3E,0x4D,0x4E,0x2F,0x40,                                   /* 0x18 ( */
+  0xF3,0x2E,0x4D,0x4E,0x3E,0x3E,0x3D,0x3D,0x3E,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3C,0x3D,0x3D,0x3C,0x3C,0x3B,0x4B,0x4C,0x2F,0xD0,                                   /* 0x19 ) */
+  0xFF,0x93,0xD3,0xD3,0x92,0x23,0x12,0x55,0x25,0x62,0x42,0xA1,0x21,0xB6,0x93,0x23,
+  0x73,0x43,0x81,0x41,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,                         /* 0x1a * */
+  0xFF,0xFF,0xFF,0xFE,0x2E,0x2E,0x2E,0x2E,0x2E,0x28,0xE2,0xE8,0x2E,0x2E,0x2E,0x2E,
+  0x2E,0x2F,0xFF,0xFF,0xC0,                                                            /* 0x1b + */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x84,0xC4,0xC4,0xC4,0xE2,0xD3,0xD2,
+  0xD2,0xF9,                                                                           /* 0x1c , */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xA6,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,     /* 0x1d - */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x84,0xC4,0xC4,0xC4,0xFF,0xFF,0xFB,     /* 0x1e . */
+  0xFE,0x2D,0x2E,0x2D,0x2E,0x2D,0x2E,0x2D,0x2E,0x2D,0x2E,0x2D,0x2E,0x2D,0x2E,0x2D,
+  0x2E,0x2D,0x2E,0x2D,0x2E,0x2D,0x2E,0x2D,0x2F,0xE0,                                   /* 0x1f / */
+  0xFF,0x75,0xA7,0x83,0x33,0x63,0x53,0x53,0x53,0x43,0x73,0x33,0x73,0x33,0x73,0x33,
+  0x73,0x33,0x73,0x33,0x73,0x33,0x73,0x33,0x73,0x33,0x73,0x43,0x53,0x53,0x53,0x63,
+  0x33,0x87,0xA5,0xFF,0xFF,0xFB,                                                       /* 0x20 0 */
+  0xFF,0xA2,0xB5,0x88,0x82,0x33,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,
+  0xD3,0xD3,0xD3,0x8D,0x3D,0xFF,0xFF,0xF6,                                             /* 0x21 1 */
+  0xFF,0x66,0x89,0x72,0x53,0xE3,0xD3,0xD3,0xD3,0xC3,0xD3,0xC3,0xC3,0xC3,0xC3,0xC3,
+  0xD2,0xD3,0xC3,0xDB,0x5B,0xFF,0xFF,0xF8,                                             /* 0x22 2 */
+  0xFF,0x66,0x99,0x71,0x54,0xD3,0xD3,0xD3,0xD2,0xD2,0xA5,0xB6,0xD4,0xD4,0xD3,0xD3,
+  0xD3,0xC4,0x61,0x44,0x78,0x87,0xFF,0xFF,0xFB,                                        /* 0x23 3 */
+  0xFF,0xB3,0xC4,0xB5,0xB5,0xA2,0x13,0x93,0x13,0x92,0x23,0x82,0x33,0x72,0x43,0x72,
+  0x43,0x62,0x53,0x52,0x63,0x5E,0x2E,0xA3,0xD3,0xD3,0xD3,0xD3,0xFF,0xFF,0xF9,          /* 0x24 4 */
+  0xFF,0x6A,0x6A,0x6A,0x62,0xE2,0xE2,0xE2,0xE2,0xE6,0xA8,0xD4,0xD4,0xD3,0xD3,0xD3,
+  0xC4,0x61,0x44,0x78,0x86,0xFF,0xFF,0xFB,                                             /* 0x25 5 */
+  0xFF,0x96,0x89,0x64,0x51,0x63,0xC3,0xD3,0xC3,0xD3,0x25,0x63,0x17,0x55,0x34,0x44,
+  0x54,0x33,0x73,0x33,0x73,0x33,0x73,0x43,0x63,0x43,0x53,0x63,0x43,0x69,0x95,0xFF,
+  0xFF,0xFA,                                                                           /* 0x26 6 */
+  0xFF,0x5B,0x5B,0x5B,0xD2,0xE2,0xD2,0xE2,0xD2,0xE1,0xE2,0xD2,0xE2,0xD2,0xE2,0xD2,
+  0xE2,0xD3,0xD2,0xE2,0xFF,0xFF,0xFF,0x00,                                             /* 0x27 7 */
+  0xFF,0x85,0x98,0x74,0x24,0x63,0x43,0x63,0x43,0x63,0x43,0x64,0x32,0x88,0x95,0xA8,
+  0x73,0x25,0x62,0x44,0x53,0x54,0x43,0x63,0x43,0x63,0x43,0x63,0x53,0x43,0x78,0x96,
+  0xFF,0xFF,0xFA,                                                                      /* 0x28 8 */
+  0xFF,0x85,0x99,0x63,0x43,0x63,0x53,0x43,0x63,0x43,0x73,0x33,0x73,0x33,0x73,0x34,
+  0x54,0x44,0x35,0x57,0x13,0x65,0x23,0xD3,0xC3,0xD3,0xC3,0x61,0x54,0x69,0x86,0xFF,
+  0xFF,0xFB,                                                                           /* 0x29 9 */
+  0xFF,0xFF,0xFF,0xFD,0x4C,0x4C,0x4C,0x4F,0xFF,0xFF,0xFF,0x34,0xC4,0xC4,0xC4,0xFF,
+  0xFF,0xFB,                                                                           /* 0x2a : */
+  0xFF,0xFF,0xFF,0xFD,0x4C,0x4C,0x4C,0x4F,0xFF,0xFF,0xFF,0x34,0xC4,0xC4,0xC4,0xE2,
+  0xD3,0xD2,0xD2,0xF9,                                                                 /* 0x2b ; */
+  0xFF,0xFF,0xFF,0xFF,0x61,0xD3,0xB4,0xA4,0xA4,0xA4,0xA4,0xC4,0xE4,0xE4,0xE4,0xE4,
+  0xE3,0xF0,0x1F,0xFF,0xFF,0x60,                                                       /* 0x2c < */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0x2E,0xFF,0xF5,0xE2,0xEF,0xFF,0xFF,0xFF,0xFF,0xA0,     /* 0x2d = */
+  0xFF,0xFF,0xFF,0xF8,0x1F,0x03,0xE4,0xE4,0xE4,0xE4,0xE4,0xC4,0xA4,0xA4,0xA4,0xA4,
+  0xB3,0xD1,0xFF,0xFF,0xFF,0x40,                                                       /* 0x2e > */
+  0xFF,0x58,0x7B,0x52,0x64,0x42,0x73,0xD3,0xD3,0xC3,0xC4,0xB4,0xB4,0xC3,0xC3,0xD3,
+  0xD3,0xFF,0xF0,0x3D,0x3D,0x3F,0xFF,0xFF,0xC0,                                        /* 0x2f ? */
+  0xFF,0x86,0x98,0x73,0x43,0x52,0x72,0x43,0x45,0x42,0x41,0x32,0x33,0x32,0x32,0x32,
+  0x32,0x42,0x32,0x32,0x42,0x32,0x32,0x33,0x32,0x32,0x33,0x32,0x32,0x24,0x32,0x32,
+  0x21,0x12,0x33,0x34,0x14,0x22,0x33,0x24,0x23,0xE3,0x51,0x88,0xA5,0xFF,0xFF,0xFA,     /* 0x30 @ */
+  0xFF,0xFF,0xFB,0x3D,0x4B,0x5B,0x21,0x3A,0x21,0x39,0x32,0x29,0x23,0x37,0x33,0x37,
+  0x34,0x36,0x25,0x35,0xC4,0xC3,0x37,0x33,0x38,0x32,0x38,0x31,0x3A,0x3F,0xFF,0xFF,
+  0x50,                                                                                /* 0x31 A */
+  0xFF,0xFF,0xF7,0x97,0xA6,0x34,0x45,0x35,0x35,0x35,0x35,0x34,0x36,0x97,0x97,0x34,
+  0x45,0x35,0x44,0x36,0x34,0x36,0x34,0x36,0x34,0x35,0x44,0xB5,0x9F,0xFF,0xFF,0xA0,     /* 0x32 B */
+  0xFF,0xFF,0xFB,0x77,0xA5,0x45,0x24,0x4C,0x3C,0x3D,0x3D,0x3D,0x3D,0x3D,0x3E,0x3D,
+  0x4D,0x46,0x16,0xA8,0x7F,0xFF,0xFF,0x80,                                             /* 0x33 C */
+  0xFF,0xFF,0xF7,0x97,0xA6,0x35,0x44,0x36,0x34,0x36,0x43,0x37,0x33,0x37,0x33,0x37,
+  0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x36,0x34,0x36,0x34,0x34,0x45,0xA6,0x8F,0xFF,
+  0xFF,0xB0,                                                                           /* 0x34 D */
+  0xFF,0xFF,0xF8,0xB5,0xB5,0x3D,0x3D,0x3D,0x3D,0x3D,0xA6,0xA6,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0xC4,0xCF,0xFF,0xFF,0x60,                                                       /* 0x35 E */
+  0xFF,0xFF,0xF8,0xC4,0xC4,0x3D,0x3D,0x3D,0x3D,0x3D,0xB5,0xB5,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3F,0xFF,0xFF,0xF0,                                                       /* 0x36 F */
+  0xFF,0xFF,0xFB,0x77,0xA5,0x45,0x24,0x4C,0x3C,0x3D,0x3D,0x3D,0x34,0x63,0x34,0x63,
+  0x37,0x34,0x36,0x34,0x45,0x35,0x44,0x36,0xA8,0x7F,0xFF,0xFF,0x80,                    /* 0x37 G */
+  0xFF,0xFF,0xF7,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,
+  0x34,0xC4,0xC4,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,
+  0x3F,0xFF,0xFF,0x70,                                                                 /* 0x38 H */
+  0xFF,0xFF,0xF7,0xB5,0xB9,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x39,0xB5,0xBF,0xFF,0xFF,0x80,                                                       /* 0x39 I */
+  0xFF,0xFF,0xF8,0x97,0x9D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x36,
+  0x15,0x37,0x88,0x7F,0xFF,0xFF,0xC0,                                                  /* 0x3a J */
+  0xFF,0xFF,0xF7,0x36,0x43,0x35,0x44,0x34,0x45,0x33,0x46,0x33,0x37,0x32,0x38,0x31,
+  0x39,0x6A,0x31,0x39,0x31,0x48,0x32,0x47,0x33,0x46,0x34,0x45,0x35,0x44,0x36,0x43,
+  0x36,0x5F,0xFF,0xFF,0x50,                                                            /* 0x3b K */
+  0xFF,0xFF,0xF8,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0xB5,0xBF,0xFF,0xFF,0x70,                                                       /* 0x3c L */
+  0xFF,0xFF,0xF6,0x37,0x33,0x45,0x43,0x45,0x43,0x45,0x43,0x21,0x23,0x21,0x23,0x21,
+  0x23,0x21,0x23,0x21,0x23,0x21,0x23,0x22,0x22,0x12,0x23,0x22,0x21,0x22,0x23,0x22,
+  0x21,0x22,0x23,0x23,0x33,0x23,0x23,0x33,0x23,0x23,0x33,0x23,0x29,0x23,0x29,0x23,
+  0x29,0x2F,0xFF,0xFF,0x70,                                                            /* 0x3d M */
+  0xFF,0xFF,0xF7,0x37,0x24,0x37,0x24,0x46,0x24,0x55,0x24,0x55,0x24,0x64,0x24,0x21,
+  0x43,0x24,0x22,0x33,0x24,0x22,0x42,0x24,0x23,0x41,0x24,0x24,0x64,0x25,0x54,0x25,
+  0x54,0x26,0x44,0x27,0x34,0x27,0x3F,0xFF,0xFF,0x70,                                   /* 0x3e N */
+  0xFF,0xFF,0xFA,0x69,0x87,0x34,0x35,0x36,0x34,0x36,0x33,0x38,0x32,0x38,0x32,0x38,
+  0x32,0x38,0x32,0x38,0x32,0x38,0x33,0x36,0x34,0x36,0x35,0x34,0x37,0x89,0x6F,0xFF,
+  0xFF,0xA0,                                                                           /* 0x3f O */
+  0xFF,0xFF,0xF8,0xA6,0xB5,0x35,0x44,0x36,0x34,0x36,0x34,0x36,0x34,0x35,0x44,0x34,
+  0x45,0xA6,0x88,0x3D,0x3D,0x3D,0x3D,0x3D,0x3F,0xFF,0xFF,0xF0,                         /* 0x40 P */
+  0xFF,0xFF,0xFA,0x69,0x87,0x34,0x35,0x36,0x34,0x36,0x33,0x38,0x32,0x38,0x32,0x38,
+  0x32,0x38,0x32,0x38,0x32,0x38,0x33,0x36,0x34,0x36,0x35,0x34,0x37,0x89,0x6E,0x4E,
+  0x4D,0x4E,0x1F,0x20,                                                                 /* 0x41 Q */
+  0xFF,0xFF,0xF7,0x97,0xA6,0x34,0x45,0x35,0x35,0x35,0x35,0x35,0x35,0x34,0x36,0x97,
+  0x88,0x32,0x47,0x33,0x37,0x33,0x46,0x34,0x45,0x35,0x44,0x36,0x34,0x36,0x4F,0xFF,
+  0xFF,0x60,                                                                           /* 0x42 R */
+  0xFF,0xFF,0xFA,0x77,0xA5,0x45,0x25,0x3D,0x3D,0x4D,0x5C,0x7B,0x7C,0x5D,0x3D,0x3D,
+  0x34,0x26,0x35,0xB7,0x7F,0xFF,0xFF,0xA0,                                             /* 0x43 S */
+  0xFF,0xFF,0xF5,0xF0,0x1F,0x07,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x3F,0xFF,0xFF,0xC0,                                                  /* 0x44 T */
+  0xFF,0xFF,0xF7,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,
+  0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x45,0x44,0x35,0x36,0x98,
+  0x7F,0xFF,0xFF,0x90,                                                                 /* 0x45 U */
+  0xFF,0xFF,0xF5,0x3A,0x31,0x38,0x32,0x38,0x33,0x37,0x33,0x36,0x34,0x45,0x35,0x35,
+  0x35,0x34,0x37,0x33,0x37,0x33,0x29,0x31,0x39,0x31,0x39,0x6B,0x5B,0x5C,0x3F,0xFF,
+  0xFF,0xB0,                                                                           /* 0x46 V */
+  0xFF,0xFF,0xF5,0x2C,0x4C,0x5B,0x21,0x24,0x24,0x22,0x23,0x43,0x22,0x23,0x43,0x22,
+  0x23,0x43,0x22,0x23,0x43,0x22,0x32,0x12,0x21,0x33,0x21,0x22,0x21,0x24,0x21,0x22,
+  0x21,0x24,0x21,0x22,0x21,0x24,0x21,0x13,0x54,0x44,0x44,0x44,0x35,0x44,0x3F,0xFF,
+  0xFF,0x80,                                                                           /* 0x47 W */
+  0xFF,0xFF,0xF6,0x48,0x32,0x46,0x34,0x44,0x35,0x43,0x37,0x41,0x39,0x6B,0x4C,0x4C,
+  0x5A,0x6A,0x21,0x48,0x23,0x46,0x25,0x44,0x36,0x33,0x37,0x41,0x39,0x4F,0xFF,0xFF,
+  0x50,                                                                                /* 0x48 X */
+  0xFF,0xFF,0xF5,0x3A,0x31,0x38,0x33,0x37,0x24,0x36,0x26,0x34,0x36,0x42,0x38,0x31,
+  0x3A,0x5B,0x5C,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3F,0xFF,0xFF,0xC0,                    /* 0x49 Y */
+  0xFF,0xFF,0xF7,0xC4,0xCD,0x3C,0x3C,0x3C,0x3C,0x3D,0x2D,0x2D,0x3C,0x3C,0x3C,0x3C,
+  0x3D,0xD3,0xDF,0xFF,0xFF,0x70,                                                       /* 0x4a Z */
+  0xF7,0x88,0x88,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x88,0x8F,0x30,                                   /* 0x4b [ */
+  0xF2,0x2F,0x02,0xE2,0xF0,0x2E,0x2F,0x02,0xE2,0xF0,0x2E,0x2F,0x02,0xE2,0xF0,0x2E,
+  0x2F,0x02,0xE2,0xF0,0x2E,0x2F,0x02,0xE2,0xF0,0x2E,0x2F,0x02,0xE2,0xF0,0x2F,0x20,     /* 0x4c \ */
+  0xF3,0x88,0x8D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x38,0x88,0x8F,0x70,                                   /* 0x4d ] */
+  0xFF,0xA1,0xF0,0x1E,0x3D,0x3C,0x4C,0x21,0x2A,0x31,0x2A,0x23,0x28,0x24,0x28,0x25,
+  0x26,0x26,0x26,0x26,0x25,0x28,0x24,0x28,0x23,0x2A,0x2F,0xFF,0xFF,0xFF,0xFF,0xA0,     /* 0x4e ^ */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6F,0xF2,0xFF,0xF3,          /* 0x4f _ */
+  0x63,0xE3,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,     /* 0x50 ` */
+  0xFF,0xFF,0xFF,0xFC,0x68,0x97,0x24,0x4D,0x3D,0x38,0x87,0x96,0x34,0x35,0x35,0x35,
+  0x35,0x35,0x35,0x35,0x43,0x46,0x71,0x45,0x43,0x4F,0xFF,0xFF,0x60,                    /* 0x51 a */
+  0xF3,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x32,0x47,0x31,0x75,0x53,0x35,0x45,0x34,0x36,
+  0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x35,0x35,0x43,0x45,0xA6,
+  0x22,0x5F,0xFF,0xFF,0xA0,                                                            /* 0x52 b */
+  0xFF,0xFF,0xFF,0xFD,0x77,0xA5,0x46,0x15,0x3C,0x3D,0x3D,0x3D,0x3D,0x3D,0x4D,0x3D,
+  0x55,0x16,0xA8,0x7F,0xFF,0xFF,0x80,                                                  /* 0x53 c */
+  0xFD,0x3D,0x3D,0x3D,0x3D,0x3D,0x37,0x42,0x35,0xB4,0x43,0x54,0x36,0x33,0x37,0x33,
+  0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x45,0x44,0x34,0x55,0x71,0x36,
+  0x52,0x3F,0xFF,0xFF,0x60,                                                            /* 0x54 d */
+  0xFF,0xFF,0xFF,0xFD,0x59,0x87,0x43,0x36,0x35,0x34,0x36,0x34,0x36,0x34,0xC4,0xC4,
+  0x3D,0x3E,0x3D,0x46,0x16,0xA8,0x7F,0xFF,0xFF,0x80,                                   /* 0x55 e */
+  0xF9,0x87,0x96,0x4C,0x3D,0x3D,0x39,0xD3,0xD7,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x3D,0x3F,0xFF,0xFF,0xC0,                                             /* 0x56 f */
+  0xFF,0xFF,0xFF,0xFD,0x42,0x35,0xB4,0x43,0x54,0x36,0x33,0x37,0x33,0x37,0x33,0x37,
+  0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x45,0x44,0x34,0x55,0x71,0x36,0x52,0x3D,0x3C,
+  0x35,0x25,0x45,0xAB,0x35,                                                            /* 0x57 g */
+  0xF3,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x33,0x46,0x31,0x75,0x53,0x44,0x45,0x34,0x36,
+  0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,
+  0x34,0x36,0x3F,0xFF,0xFF,0x70,                                                       /* 0x58 h */
+  0xF8,0x3D,0x3D,0x3F,0xFF,0xB8,0x88,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,
+  0xD3,0xD3,0xD3,0xFF,0xFF,0xFB,                                                       /* 0x59 i */
+  0xFA,0x3D,0x3D,0x3F,0xFF,0xA9,0x79,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,
+  0xD3,0xD3,0xD3,0xD3,0xD3,0x61,0x53,0x79,0x86,0x70,                                   /* 0x5a j */
+  0xF4,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x34,0x45,0x33,0x46,0x33,0x37,0x32,0x47,0x31,
+  0x48,0x31,0x39,0x79,0x31,0x39,0x31,0x48,0x32,0x47,0x33,0x37,0x33,0x46,0x34,0x45,
+  0x35,0x4F,0xFF,0xFF,0x60,                                                            /* 0x5b k */
+  0xF4,0x88,0x8D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x3D,0x3F,0xFF,0xFF,0xA0,                                             /* 0x5c l */
+  0xFF,0xFF,0xFF,0xF8,0x32,0x33,0x23,0x31,0x42,0x42,0xE2,0x42,0x41,0x32,0x42,0x32,
+  0x32,0x33,0x32,0x32,0x33,0x32,0x32,0x33,0x32,0x32,0x33,0x32,0x32,0x33,0x32,0x32,
+  0x33,0x32,0x32,0x33,0x32,0x32,0x33,0x32,0x32,0x33,0x32,0x3F,0xFF,0xFF,0x60,          /* 0x5d m */
+  0xFF,0xFF,0xFF,0xF9,0x33,0x46,0x31,0x75,0x53,0x44,0x45,0x34,0x36,0x34,0x36,0x34,
+  0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x3F,
+  0xFF,0xFF,0x70,                                                                      /* 0x5e n */
+  0xFF,0xFF,0xFF,0xFC,0x59,0x96,0x43,0x45,0x35,0x34,0x37,0x33,0x37,0x33,0x37,0x33,
+  0x37,0x33,0x37,0x33,0x37,0x34,0x35,0x35,0x43,0x46,0x99,0x5F,0xFF,0xFF,0xB0,          /* 0x5f o */
+  0xFF,0xFF,0xFF,0xF9,0x32,0x47,0x31,0x75,0x53,0x35,0x45,0x34,0x36,0x34,0x36,0x34,
+  0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x35,0x35,0x43,0x45,0xA6,0x32,0x47,0x3D,
+  0x3D,0x3D,0x3D,0x3B,                                                                 /* 0x60 p */
+  0xFF,0xFF,0xFF,0xFC,0x42,0x35,0xB4,0x43,0x54,0x36,0x33,0x37,0x33,0x37,0x33,0x37,
+  0x33,0x37,0x33,0x37,0x33,0x37,0x33,0x45,0x44,0x34,0x55,0x71,0x36,0x43,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x32,                                                                 /* 0x61 q */
+  0xFF,0xFF,0xFF,0xFB,0x32,0x56,0x31,0x66,0x53,0x26,0x44,0x26,0x3D,0x3D,0x3D,0x3D,
+  0x3D,0x3D,0x3D,0x3D,0x3D,0x3F,0xFF,0xFF,0xE0,                                        /* 0x62 r */
+  0xFF,0xFF,0xFF,0xFC,0x78,0x96,0x45,0x16,0x3D,0x3D,0x6B,0x7C,0x6D,0x4D,0x3D,0x35,
+  0x25,0x45,0xA7,0x7F,0xFF,0xFF,0xA0,                                                  /* 0x63 s */
+  0xFF,0xFF,0xFA,0x3D,0x3A,0xC4,0xC7,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,0x3D,
+  0x4D,0x89,0x7F,0xFF,0xFF,0x70,                                                       /* 0x64 t */
+  0xFF,0xFF,0xFF,0xF9,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,
+  0x36,0x34,0x36,0x34,0x36,0x34,0x36,0x34,0x35,0x44,0x43,0x55,0x71,0x36,0x43,0x3F,
+  0xFF,0xFF,0x70,                                                                      /* 0x65 u */
+  0xFF,0xFF,0xFF,0xF8,0x47,0x33,0x36,0x34,0x36,0x34,0x45,0x35,0x35,0x26,0x34,0x37,
+  0x33,0x37,0x33,0x29,0x31,0x39,0x31,0x39,0x31,0x2B,0x5B,0x5C,0x3F,0xFF,0xFF,0xB0,     /* 0x66 v */
+  0xFF,0xFF,0xFF,0xF7,0x2C,0x54,0x34,0x54,0x34,0x12,0x23,0x43,0x22,0x23,0x43,0x22,
+  0x23,0x12,0x13,0x22,0x31,0x22,0x22,0x22,0x31,0x22,0x22,0x14,0x21,0x22,0x21,0x24,
+  0x21,0x13,0x21,0x24,0x44,0x44,0x44,0x44,0x44,0x36,0x25,0x3F,0xFF,0xFF,0x80,          /* 0x67 w */
+  0xFF,0xFF,0xFF,0xF8,0x47,0x24,0x45,0x26,0x43,0x28,0x32,0x38,0x41,0x2A,0x5C,0x4C,
+  0x4B,0x69,0x31,0x48,0x23,0x37,0x33,0x45,0x35,0x43,0x37,0x4F,0xFF,0xFF,0x60,          /* 0x68 x */
+  0xFF,0xFF,0xFF,0xF8,0x47,0x33,0x37,0x24,0x36,0x35,0x35,0x26,0x34,0x36,0x43,0x37,
+  0x32,0x38,0x41,0x39,0x6A,0x6B,0x4C,0x4C,0x3E,0x2D,0x3D,0x2D,0x3A,0x5B,0x4A,          /* 0x69 y */
+  0xFF,0xFF,0xFF,0xF9,0xC4,0xCD,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3D,
+  0xC4,0xCF,0xFF,0xFF,0x70,                                                            /* 0x6a z */
+  0xF9,0x5A,0x69,0x4C,0x3D,0x3D,0x3E,0x3D,0x3D,0x3D,0x3C,0x3A,0x5B,0x5E,0x3E,0x3D,
+  0x3D,0x3D,0x3C,0x3D,0x3D,0x3D,0x4D,0x6B,0x5F,0x40,                                   /* 0x6b { */
+  0xF8,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,
+  0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2E,0x2F,0x80,                                   /* 0x6c | */
+  0xF3,0x5B,0x6D,0x4D,0x3D,0x3D,0x3C,0x3D,0x3D,0x3D,0x3E,0x3E,0x5B,0x5A,0x3C,0x3D,
+  0x3D,0x3D,0x3E,0x3D,0x3D,0x3C,0x49,0x6A,0x5F,0xA0,                                   /* 0x6d } */
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x46,0x23,0x83,0x22,0x23,0x83,0x26,0x4F,0xFF,
+  0xFF,0xFF,0xFF,0xFD                                                                  /* 0x6e ~ */
+};
+
+
+/* start of bitmaps in FontData */
+const uint16_t FontIndex[] PROGMEM = {
+  /* symbols and special characters */
+  0,        /* 0x00 n/a */
+  14,       /* 0x01 symbol: diode A-C */
+  56,       /* 0x02 symbol: diode C-A */
+  98,       /* 0x03 symbol: capacitor */
+  141,      /* 0x04 omega */
+  182,      /* 0x05  (micro) */
+  220,      /* 0x06 symbol: resistor left side */
+  244,      /* 0x07 symbol: resistor right side */
+  268,      /* 0x08  */
+  304,      /* 0x09  */
+  341,      /* 0x0a  */
+  380,      /* 0x0b  */
+  423,      /* 0x0c  */
+  455,      /* 0x0d  */
+  489,      /* 0x0e  */
+  527,      /* 0x0f n/a */
+  /* standard characters */
+  541,      /* 0x10 space */
+  555,      /* 0x11 ! */
+  578,      /* 0x12 " */
+  603,      /* 0x13 # */
+  641,      /* 0x14 $ */
+  678,      /* 0x15 % */
+  733,      /* 0x16 & */
+  772,      /* 0x17  */
+  790,      /* 0x18 ( */
+  816,      /* 0x19 ) */
+  842,      /* 0x1a * */
+  870,      /* 0x1b + */
+  891,      /* 0x1c , */
+  909,      /* 0x1d - */
+  925,      /* 0x1e . */
+  941,      /* 0x1f / */
+  967,      /* 0x20 0 */
+  1005,     /* 0x21 1 */
+  1029,     /* 0x22 2 */
+  1053,     /* 0x23 3 */
+  1078,     /* 0x24 4 */
+  1109,     /* 0x25 5 */
+  1133,     /* 0x26 6 */
+  1167,     /* 0x27 7 */
+  1191,     /* 0x28 8 */
+  1226,     /* 0x29 9 */
+  1260,     /* 0x2a : */
+  1278,     /* 0x2b ; */
+  1298,     /* 0x2c < */
+  1320,     /* 0x2d = */
+  1336,     /* 0x2e > */
+  1358,     /* 0x2f ? */
+  1383,     /* 0x30 @ */
+  1431,     /* 0x31 A */
+  1464,     /* 0x32 B */
+  1496,     /* 0x33 C */
+  1520,     /* 0x34 D */
+  1554,     /* 0x35 E */
+  1576,     /* 0x36 F */
+  1598,     /* 0x37 G */
+  1627,     /* 0x38 H */
+  1663,     /* 0x39 I */
+  1685,     /* 0x3a J */
+  1708,     /* 0x3b K */
+  1745,     /* 0x3c L */
+  1767,     /* 0x3d M */
+  1820,     /* 0x3e N */
+  1862,     /* 0x3f O */
+  1896,     /* 0x40 P */
+  1924,     /* 0x41 Q */
+  1960,     /* 0x42 R */
+  1994,     /* 0x43 S */
+  2018,     /* 0x44 T */
+  2041,     /* 0x45 U */
+  2077,     /* 0x46 V */
+  2111,     /* 0x47 W */
+  2161,     /* 0x48 X */
+  2194,     /* 0x49 Y */
+  2223,     /* 0x4a Z */
+  2245,     /* 0x4b [ */
+  2271,     /* 0x4c \ */
+  2303,     /* 0x4d ] */
+  2329,     /* 0x4e ^ */
+  2361,     /* 0x4f _ */
+  2376,     /* 0x50 ` */
+  2392,     /* 0x51 a */
+  2421,     /* 0x52 b */
+  2458,     /* 0x53 c */
+  2481,     /* 0x54 d */
+  2518,     /* 0x55 e */
+  2544,     /* 0x56 f */
+  2568,     /* 0x57 g */
+  2605,     /* 0x58 h */
+  2643,     /* 0x59 i */
+  2665,     /* 0x5a j */
+  2691,     /* 0x5b k */
+  2728,     /* 0x5c l */
+  2752,     /* 0x5d m */
+  2799,     /* 0x5e n */
+  2834,     /* 0x5f o */
+  2865,     /* 0x60 p */
+  2901,     /* 0x61 q */
+  2937,     /* 0x62 r */
+  2962,     /* 0x63 s */
+  2985,     /* 0x64 t */
+  3007,     /* 0x65 u */
+  3042,     /* 0x66 v */
+  3074,     /* 0x67 w */
+  3121,     /* 0x68 x */
+  3152,     /* 0x69 y */
+  3183,     /* 0x6a z */
+  3204,     /* 0x6b { */
+  3230,     /* 0x6c | */
+  3256,     /* 0x6d } */
+  3282      /* 0x6e ~ */
+};
+
+
+/*
+ *  font lookup table for ISO 8859-1
+ *  - 8 bit ISO 8859-1 to custom font
+ *  - ff: no bitmap available
+ */
+
+const uint8_t FontTable[] PROGMEM = {
+  0xff,        /* 0x00 -> n/a */
+  0x01,        /* 0x01 -> symbol: diode A-C */
+  0x02,        /* 0x02 -> symbol: diode C-A */
+  0x03,        /* 0x03 -> symbol: capacitor */
+  0x04,        /* 0x04 -> omega */
+  0x05,        /* 0x05 ->  (micro) */
+  0x06,        /* 0x06 -> symbol: resistor left side */
+  0x07,        /* 0x07 -> symbol: resistor right side */
+  0xff,        /* 0x08 -> n/a */
+  0xff,        /* 0x09 -> n/a */
+  0xff,        /* 0x0a -> n/a */
+  0xff,        /* 0x0b -> n/a */
+  0xff,        /* 0x0c -> n/a */
+  0xff,        /* 0x0d -> n/a */
+  0xff,        /* 0x0e -> n/a */
+  0xff,        /* 0x0f -> n/a */
+
+  0xff,        /* 0x10 -> n/a */
+  0xff,        /* 0x11 -> n/a */
+  0xff,        /* 0x12 -> n/a */
+  0xff,        /* 0x13 -> n/a */
+  0xff,        /* 0x14 -> n/a */
+  0xff,        /* 0x15 -> n/a */
+  0xff,        /* 0x16 -> n/a */
+  0xff,        /* 0x17 -> n/a */
+  0xff,        /* 0x18 -> n/a */
+  0xff,        /* 0x19 -> n/a */
+  0xff,        /* 0x1a -> n/a */
+  0xff,        /* 0x1b -> n/a */
+  0xff,        /* 0x1c -> n/a */
+  0xff,        /* 0x1d -> n/a */
+  0xff,        /* 0x1e -> n/a */
+  0xff,        /* 0x1f -> n/a */
+
+  0x10,        /* 0x20 -> space */
+  0x11,        /* 0x21 -> ! */
+  0x12,        /* 0x22 -> " */
+  0x13,        /* 0x23 -> # */
+  0x14,        /* 0x24 -> $ */
+  0x15,        /* 0x25 -> % */
+  0x16,        /* 0x26 -> & */
+  0x17,        /* 0x27 ->  */
+  0x18,        /* 0x28 -> ( */
+  0x19,        /* 0x29 -> ) */
+  0x1a,        /* 0x2a -> * */
+  0x1b,        /* 0x2b -> + */
+  0x1c,        /* 0x2c -> , */
+  0x1d,        /* 0x2d -> - */
+  0x1e,        /* 0x2e -> . */
+  0x1f,        /* 0x2f -> / */
+
+  0x20,        /* 0x30 -> 0 */
+  0x21,        /* 0x31 -> 1 */
+  0x22,        /* 0x32 -> 2 */
+  0x23,        /* 0x33 -> 3 */
+  0x24,        /* 0x34 -> 4 */
+  0x25,        /* 0x35 -> 5 */
+  0x26,        /* 0x36 -> 6 */
+  0x27,        /* 0x37 -> 7 */
+  0x28,        /* 0x38 -> 8 */
+  0x29,        /* 0x39 -> 9 */
+  0x2a,        /* 0x3a -> : */
+  0x2b,        /* 0x3b -> ; */
+  0x2c,        /* 0x3c -> < */
+  0x2d,        /* 0x3d -> = */
+  0x2e,        /* 0x3e -> > */
+  0x2f,        /* 0x3f -> ? */
+
+  0x30,        /* 0x40 -> @ */
+  0x31,        /* 0x41 -> A */
+  0x32,        /* 0x42 -> B */
+  0x33,        /* 0x43 -> C */
+  0x34,        /* 0x44 -> D */
+  0x35,        /* 0x45 -> E */
+  0x36,        /* 0x46 -> F */
+  0x37,        /* 0x47 -> G */
+  0x38,        /* 0x48 -> H */
+  0x39,        /* 0x49 -> I */
+  0x3a,        /* 0x4a -> J */
+  0x3b,        /* 0x4b -> K */
+  0x3c,        /* 0x4c -> L */
+  0x3d,        /* 0x4d -> M */
+  0x3e,        /* 0x4e -> N */
+  0x3f,        /* 0x4f -> O */
+
+  0x40,        /* 0x50 -> P */
+  0x41,        /* 0x51 -> Q */
+  0x42,        /* 0x52 -> R */
+  0x43,        /* 0x53 -> S */
+  0x44,        /* 0x54 -> T */
+  0x45,        /* 0x55 -> U */
+  0x46,        /* 0x56 -> V */
+  0x47,        /* 0x57 -> W */
+  0x48,        /* 0x58 -> X */
+  0x49,        /* 0x59 -> Y */
+  0x4a,        /* 0x5a -> Z */
+  0x4b,        /* 0x5b -> [ */
+  0x4c,        /* 0x5c -> \ */
+  0x4d,        /* 0x5d -> ] */
+  0x4e,        /* 0x5e -> ^ */
+  0x4f,        /* 0x5f -> _ */
+
+  0x50,        /* 0x60 -> ` */
+  0x51,        /* 0x61 -> a */
+  0x52,        /* 0x62 -> b */
+  0x53,        /* 0x63 -> c */
+  0x54,        /* 0x64 -> d */
+  0x55,        /* 0x65 -> e */
+  0x56,        /* 0x66 -> f */
+  0x57,        /* 0x67 -> g */
+  0x58,        /* 0x68 -> h */
+  0x59,        /* 0x69 -> i */
+  0x5a,        /* 0x6a -> j */
+  0x5b,        /* 0x6b -> k */
+  0x5c,        /* 0x6c -> l */
+  0x5d,        /* 0x6d -> m */
+  0x5e,        /* 0x6e -> n */
+  0x5f,        /* 0x6f -> o */
+
+  0x60,        /* 0x70 -> p */
+  0x61,        /* 0x71 -> q */
+  0x62,        /* 0x72 -> r */
+  0x63,        /* 0x73 -> s */
+  0x64,        /* 0x74 -> t */
+  0x65,        /* 0x75 -> u */
+  0x66,        /* 0x76 -> v */
+  0x67,        /* 0x77 -> w */
+  0x68,        /* 0x78 -> x */
+  0x69,        /* 0x79 -> y */
+  0x6a,        /* 0x7a -> z */
+  0x6b,        /* 0x7b -> { */
+  0x6c,        /* 0x7c -> | */
+  0x6d,        /* 0x7d -> } */
+  0x6e,        /* 0x7e -> ~ */
+  0xff,        /* 0x7f -> n/a */
+
+  0xff,        /* 0x80 -> n/a */
+  0xff,        /* 0x81 -> n/a */
+  0xff,        /* 0x82 -> n/a */
+  0xff,        /* 0x83 -> n/a */
+  0xff,        /* 0x84 -> n/a */
+  0xff,        /* 0x85 -> n/a */
+  0xff,        /* 0x86 -> n/a */
+  0xff,        /* 0x87 -> n/a */
+  0xff,        /* 0x88 -> n/a */
+  0xff,        /* 0x89 -> n/a */
+  0xff,        /* 0x8a -> n/a */
+  0xff,        /* 0x8b -> n/a */
+  0xff,        /* 0x8c -> n/a */
+  0xff,        /* 0x8d -> n/a */
+  0xff,        /* 0x8e -> n/a */
+  0xff,        /* 0x8f -> n/a */
+
+  0xff,        /* 0x90 -> n/a */
+  0xff,        /* 0x91 -> n/a */
+  0xff,        /* 0x92 -> n/a */
+  0xff,        /* 0x93 -> n/a */
+  0xff,        /* 0x94 -> n/a */
+  0xff,        /* 0x95 -> n/a */
+  0xff,        /* 0x96 -> n/a */
+  0xff,        /* 0x97 -> n/a */
+  0xff,        /* 0x98 -> n/a */
+  0xff,        /* 0x99 -> n/a */
+  0xff,        /* 0x9a -> n/a */
+  0xff,        /* 0x9b -> n/a */
+  0xff,        /* 0x9c -> n/a */
+  0xff,        /* 0x9d -> n/a */
+  0xff,        /* 0x9e -> n/a */
+  0xff,        /* 0x9f -> n/a */
+
+  0xff,        /* 0xa0 -> n/a */
+  0xff,        /* 0xa1 -> n/a */
+  0xff,        /* 0xa2 -> n/a */
+  0xff,        /* 0xa3 -> n/a */
+  0xff,        /* 0xa4 -> n/a */
+  0xff,        /* 0xa5 -> n/a */
+  0xff,        /* 0xa6 -> n/a */
+  0xff,        /* 0xa7 -> n/a */
+  0xff,        /* 0xa8 -> n/a */
+  0xff,        /* 0xa9 -> n/a */
+  0xff,        /* 0xaa -> n/a */
+  0xff,        /* 0xab -> n/a */
+  0xff,        /* 0xac -> n/a */
+  0xff,        /* 0xad -> n/a */
+  0xff,        /* 0xae -> n/a */
+  0xff,        /* 0xaf -> n/a */
+
+  0xff,        /* 0xb0 -> n/a */
+  0xff,        /* 0xb1 -> n/a */
+  0xff,        /* 0xb2 -> n/a */
+  0xff,        /* 0xb3 -> n/a */
+  0xff,        /* 0xb4 -> n/a */
+  0x05,        /* 0xb5 ->  (micro) */
+  0xff,        /* 0xb6 -> n/a */
+  0xff,        /* 0xb7 -> n/a */
+  0xff,        /* 0xb8 -> n/a */
+  0xff,        /* 0xb9 -> n/a */
+  0xff,        /* 0xba -> n/a */
+  0xff,        /* 0xbb -> n/a */
+  0xff,        /* 0xbc -> n/a */
+  0xff,        /* 0xbd -> n/a */
+  0xff,        /* 0xbe -> n/a */
+  0xff,        /* 0xbf -> n/a */
+
+  0xff,        /* 0xc0 -> n/a */
+  0xff,        /* 0xc1 -> n/a */
+  0xff,        /* 0xc2 -> n/a */
+  0xff,        /* 0xc3 -> n/a */
+  0x08,        /* 0xc4 ->  */
+  0xff,        /* 0xc5 -> n/a */
+  0xff,        /* 0xc6 -> n/a */
+  0xff,        /* 0xc7 -> n/a */
+  0xff,        /* 0xc8 -> n/a */
+  0xff,        /* 0xc9 -> n/a */
+  0xff,        /* 0xca -> n/a */
+  0xff,        /* 0xcb -> n/a */
+  0xff,        /* 0xcc -> n/a */
+  0xff,        /* 0xcd -> n/a */
+  0xff,        /* 0xce -> n/a */
+  0xff,        /* 0xcf -> n/a */
+
+  0xff,        /* 0xd0 -> n/a */
+  0xff,        /* 0xd1 -> n/a */
+  0xff,        /* 0xd2 -> n/a */
+  0xff,        /* 0xd3 -> n/a */
+  0xff,        /* 0xd4 -> n/a */
+  0xff,        /* 0xd5 -> n/a */
+  0x09,        /* 0xd6 ->  */
+  0xff,        /* 0xd7 -> n/a */
+  0xff,        /* 0xd8 -> n/a */
+  0xff,        /* 0xd9 -> n/a */
+  0xff,        /* 0xda -> n/a */
+  0xff,        /* 0xdb -> n/a */
+  0x0a,        /* 0xdc ->  */
+  0xff,        /* 0xdd -> n/a */
+  0xff,        /* 0xde -> n/a */
+  0x0b,        /* 0xdf ->  */
+
+  0xff,        /* 0xe0 -> n/a */
+  0xff,        /* 0xe1 -> n/a */
+  0xff,        /* 0xe2 -> n/a */
+  0xff,        /* 0xe3 -> n/a */
+  0x0c,        /* 0xe4 ->  */
+  0xff,        /* 0xe5 -> n/a */
+  0xff,        /* 0xe6 -> n/a */
+  0xff,        /* 0xe7 -> n/a */
+  0xff,        /* 0xe8 -> n/a */
+  0xff,        /* 0xe9 -> n/a */
+  0xff,        /* 0xea -> n/a */
+  0xff,        /* 0xeb -> n/a */
+  0xff,        /* 0xec -> n/a */
+  0xff,        /* 0xed -> n/a */
+  0xff,        /* 0xee -> n/a */
+  0xff,        /* 0xef -> n/a */
+
+  0xff,        /* 0xf0 -> n/a */
+  0xff,        /* 0xf1 -> n/a */
+  0xff,        /* 0xf2 -> n/a */
+  0xff,        /* 0xf3 -> n/a */
+  0xff,        /* 0xf4 -> n/a */
+  0xff,        /* 0xf5 -> n/a */
+  0x0d,        /* 0xf6 ->  */
+  0xff,        /* 0xf7 -> n/a */
+  0xff,        /* 0xf8 -> n/a */
+  0xff,        /* 0xf9 -> n/a */
+  0xff,        /* 0xfa -> n/a */
+  0xff,        /* 0xfb -> n/a */
+  0x0e,        /* 0xfc ->  */
+  0xff,        /* 0xfd -> n/a */
+  0xff,        /* 0xfe -> n/a */
+  0xff,        /* 0xff -> n/a */
+};
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+# ************************************************************************
+#
+#   converter for run-length encoded bitmaps
+#
+#   (c) 2026 by agent
+#
+# ************************************************************************
+
+#
+#  hints:
+#  - converts a horizontally aligned and flipped font or symbol header
+#    (*_hf.h) into a run-length encoded one (*_hf_rle.h)
+#  - usage: rle.py <source header> <output header>
+#  - encoding:
+#    - all pixels of a bitmap (row by row, top to bottom, left to right)
+#      are split into runs of alternating color, starting with the
+#      background color
+#    - each run is stored as a sequence of nibbles (high nibble first):
+#      15 adds 15 pixels and continues the run, 0-14 adds the given
+#      number of pixels and ends the run
+#    - each bitmap starts at a byte boundary, unused low nibble is 0
+#    - an offset table (uint16_t) points to the start of each bitmap
+#  - the table following the bitmaps (FontTable or PinTable) and a
+#    conditional last bitmap (#ifdef ... #endif) are kept as they are
+#
+
+import re
+import sys
+
+
+#
+#  read the data format of the source header
+#
+
+def get_define(text, name):
+  match = re.search(r'#define\s+' + name + r'\s+(\d+)', text)
+  if match is None:
+    sys.exit('error: ' + name + ' not found')
+  return int(match.group(1))
+
+
+#
+#  get pixels of bitmap (list of 0/1)
+#
+
+def get_pixels(data, size_x, size_y, bytes_x):
+  pixels = []
+  for y in range(size_y):
+    for x in range(size_x):
+      byte = data[y * bytes_x + x // 8]
+      pixels.append((byte >> (x % 8)) & 1)    # bit #0 is left
+  return pixels
+
+
+#
+#  encode pixels into bytes with run-length nibbles
+#
+
+def encode(pixels):
+  nibbles = []
+  color = 0                             # start with background
+  run = 0
+
+  for pixel in pixels + [None]:         # None flushes last run
+    if pixel == color:
+      run += 1
+      continue
+
+    while run >= 15:                    # long run
+      nibbles.append(15)
+      run -= 15
+    nibbles.append(run)                 # end of run
+
+    color = pixel
+    run = 1
+
+  if len(nibbles) % 2:                  # align to byte
+    nibbles.append(0)
+
+  return [(nibbles[n] << 4) | nibbles[n + 1]
+          for n in range(0, len(nibbles), 2)]
+
+
+#
+#  parse the bitmap array into a list of items:
+#  - (data, comment, comma) for a bitmap
+#  - (None, line, None) for any other line (comments, conditionals)
+#
+
+def parse_array(array):
+  items = []
+  data = []
+
+  for line in array.splitlines():
+    code = line.split('/*')[0].strip()
+    values = re.findall(r'0x[0-9A-Fa-f]{2}', code)
+    if not values:                      # other line
+      items.append((None, line, None))
+      continue
+    data += [int(x, 16) for x in values]
+    if '/*' in line:                    # comment marks end of bitmap
+      comment = line.split('/*')[1].split('*/')[0].strip()
+      items.append((data, comment, code.endswith(',')))
+      data = []
+
+  return items
+
+
+#
+#  main
+#
+
+def main():
+  if len(sys.argv) != 3:
+    sys.exit('usage: rle.py <source header> <output header>')
+
+  source = open(sys.argv[1], encoding='latin-1').read()
+
+  if 'FontData[]' in source:
+    kind, name = 'FONT', 'Font'
+  else:
+    kind, name = 'SYMBOL', 'Symbol'
+
+  size_x = get_define(source, kind + '_SIZE_X')
+  size_y = get_define(source, kind + '_SIZE_Y')
+  bytes_n = get_define(source, kind + '_BYTES_N')
+  bytes_x = get_define(source, kind + '_BYTES_X')
+
+  # split source into head, bitmap array and tail
+  match = re.search(r'const uint8_t ' + name + r'Data\[\] PROGMEM = \{\n' +
+                    r'(.*?)\n\};\n', source, re.S)
+  if match is None:
+    sys.exit('error: ' + name + 'Data not found')
+  head = source[:match.start()]
+  tail = source[match.end():]
+
+  items = parse_array(match.group(1))
+
+  # encode bitmaps
+  lines = []
+  index = []
+  offset = 0
+  raw = 0
+  total = 0
+
+  for data, comment, comma in items:
+    if data is None:                    # other line
+      lines.append(comment)
+      if comment.strip() != '':
+        index.append(comment)
+      continue
+
+    if len(data) != bytes_n:
+      sys.exit('error: bad bitmap size (' + comment + ')')
+
+    rle = encode(get_pixels(data, size_x, size_y, bytes_x))
+    sep = ',' if comma else ''
+
+    for m in range(0, len(rle), 16):
+      if m > 0:
+        lines[-1] += ','
+      lines.append('  ' + ','.join('0x%02X' % x for x in rle[m:m + 16]))
+    lines[-1] = (lines[-1] + sep).ljust(84) + '   /* ' + comment + ' */'
+    index.append(('  %d' % offset + sep).ljust(12) +
+                 '/* ' + comment + ' */')
+
+    offset += len(rle)
+    raw += bytes_n
+    total += len(rle) + 2
+
+  # update description
+  head = head.replace(' *   horizontally aligned, horizontal bit order flipped\n',
+                      ' *   horizontally aligned, run-length encoded\n' +
+                      ' *   generated by rle.py from ' +
+                      sys.argv[1].split('/')[-1] + ', do not edit\n', 1)
+  head = re.sub(r'/\* ' + kind.lower() + r' data format \*/\n' +
+                r'(#define ' + kind + r'_BYTES_\w+\s+\d+\s+/\*.*?\*/\n)+',
+                '/* ' + kind.lower() + ' data format */\n' +
+                ('#define ' + kind + '_RLE').ljust(35) +
+                '/* run-length encoded */\n', head)
+  head = re.sub(r' \*  - format:\n.*?(?= \*/\n)',
+                ' *  - format:\n'
+                ' *    - pixel runs of alternating color, starting with\n'
+                ' *      background, pixels row by row (top to down)\n'
+                ' *    - nibbles, high nibble first: 15 adds 15 pixels\n'
+                ' *      and continues the run, 0-14 adds the number\n'
+                ' *      of pixels and ends the run\n'
+                ' *    - each bitmap starts at a byte boundary\n'
+                ' *    - %d bytes plus offset table (uncompressed %d bytes)\n'
+                % (offset, raw),
+                head, count=1, flags=re.S)
+
+  out = head
+  out += 'const uint8_t ' + name + 'Data[] PROGMEM = {\n'
+  out += '\n'.join(lines) + '\n};\n\n\n'
+  out += '/* start of bitmaps in ' + name + 'Data */\n'
+  out += 'const uint16_t ' + name + 'Index[] PROGMEM = {\n'
+  out += '\n'.join(index) + '\n'
+  out += '};\n'
+  out += tail
+
+  open(sys.argv[2], 'w', encoding='latin-1').write(out)
+
+  print('%s: %d bytes (%d bytes uncompressed)' %
+        (sys.argv[2], total, raw))
+
+
+if __name__ == '__main__':
+  main()
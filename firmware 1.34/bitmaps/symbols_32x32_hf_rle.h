@@ -0,0 +1,222 @@
+/* ************************************************************************
+ *
+ *   32x32 component symbols 
+ *   horizontally aligned, run-length encoded
+ *   generated by rle.py from symbols_32x32_hf.h, do not edit
+ *
+ *   (c) 2015-2017 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   symbol data
+ * ************************************************************************ */
+
+#ifdef SYMBOLS_32X32_HF
+
+
+/* symbol size */
+#define SYMBOL_SIZE_X       32     /* width:  32 dots */
+#define SYMBOL_SIZE_Y       32     /* heigth: 32 dots */
+
+/* symbol data format */
+#define SYMBOL_RLE                 /* run-length encoded */
+
+
+/*
+ *  symbol bitmaps
+ *  - format:
+ *    - pixel runs of alternating color, starting with
+ *      background, pixels row by row (top to down)
+ *    - nibbles, high nibble first: 15 adds 15 pixels
+ *      and continues the run, 0-14 adds the number
+ *      of pixels and ends the run
+ *    - each bitmap starts at a byte boundary
+ *    - 1384 bytes plus offset table (uncompressed 1792 bytes)
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x1D,
+  0x13,0x1C,0x14,0x27,0x15,0x1A,0x15,0x26,0x17,0x19,0x15,0x25,0x18,0x18,0x16,0x24,
+  0x1A,0x17,0x16,0x23,0x1B,0x17,0x16,0x22,0x1C,0x16,0x17,0x21,0x1E,0x15,0x17,0x3F,
+  0x01,0x2D,0xF1,0x15,0x17,0x3F,0x01,0x51,0x72,0x11,0xE1,0x61,0x62,0x21,0xC1,0x71,
+  0x62,0x31,0x21,0x81,0x71,0x62,0x43,0x81,0x81,0x52,0x43,0x71,0x91,0x52,0x34,0x71,
+  0xA1,0x42,0x71,0x51,0xC1,0xD1,0x31,0xE1,0xC1,0x21,0xF1,0x2A,0x3F,0x43,0x53,0xF9,
+  0x52,0x1F,0xF1,0x1F,0xF1,0x1F,0xFC,                                                  /* BJT npn */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x1D,
+  0x13,0x1C,0x1D,0x15,0x1A,0x15,0x23,0x12,0x17,0x19,0x15,0x23,0x38,0x18,0x16,0x23,
+  0x39,0x17,0x16,0x23,0x48,0x17,0x16,0x22,0x1C,0x16,0x17,0x21,0x1E,0x15,0x17,0x3F,
+  0x01,0x2D,0xF1,0x15,0x17,0x3F,0x01,0x51,0x72,0x11,0xE1,0x61,0x62,0x21,0xC1,0x71,
+  0x62,0x31,0xB1,0x71,0x62,0x41,0xA1,0x81,0x52,0x51,0x81,0x91,0x52,0x61,0x71,0xA1,
+  0xD1,0x51,0xC1,0xD1,0x31,0xE1,0xC1,0x21,0xF1,0x2A,0x3F,0x43,0x53,0xF9,0x52,0x1F,
+  0xF1,0x1F,0xF1,0x1F,0xFC,                                                            /* BJT pnp */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x15,
+  0x17,0x13,0x1C,0x16,0x17,0x14,0x1A,0x15,0x11,0x95,0x19,0x15,0x11,0x1D,0x18,0x16,
+  0x11,0x1E,0x17,0x16,0x1F,0x11,0x71,0x61,0xF1,0x16,0x17,0x11,0x14,0x1A,0x15,0x17,
+  0x11,0x13,0x2A,0x15,0x17,0x11,0x97,0x15,0x17,0x11,0x13,0x22,0x17,0x15,0x17,0x11,
+  0x14,0x12,0x17,0x16,0x16,0x19,0x16,0x17,0x16,0x19,0x16,0x17,0x16,0x11,0x17,0x16,
+  0x18,0x15,0x11,0x17,0x15,0x14,0xC1,0x95,0x1A,0x16,0x17,0x14,0x1C,0x15,0x17,0x13,
+  0x1E,0x1C,0x12,0x1F,0x12,0xA3,0xF4,0x35,0x3F,0x95,0x21,0xFF,0x11,0xFF,0x11,0xFF,
+  0xC0,                                                                                /* MOSFET enh n-ch */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x15,
+  0x17,0x13,0x1C,0x16,0x17,0x14,0x15,0xC1,0x95,0x19,0x15,0x11,0x17,0x15,0x18,0x16,
+  0x11,0x17,0x16,0x17,0x16,0x19,0x16,0x17,0x16,0x19,0x16,0x16,0x17,0x11,0x13,0x13,
+  0x17,0x15,0x17,0x11,0x13,0x22,0x17,0x15,0x17,0x11,0x97,0x15,0x17,0x11,0x13,0x2A,
+  0x15,0x17,0x11,0x13,0x1B,0x16,0x16,0x1F,0x11,0x71,0x61,0xF1,0x17,0x16,0x11,0x1E,
+  0x18,0x15,0x11,0x1D,0x19,0x15,0x11,0x95,0x1A,0x16,0x17,0x14,0x1C,0x15,0x17,0x13,
+  0x1E,0x1C,0x12,0x1F,0x12,0xA3,0xF4,0x35,0x3F,0x95,0x21,0xFF,0x11,0xFF,0x11,0xFF,
+  0xC0,                                                                                /* MOSFET enh p-ch */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x15,
+  0x17,0x13,0x1C,0x16,0x17,0x14,0x1A,0x15,0x11,0x95,0x19,0x15,0x11,0x1D,0x18,0x16,
+  0x11,0x1E,0x17,0x16,0x11,0x1E,0x17,0x16,0x11,0x1E,0x16,0x17,0x11,0x14,0x1A,0x15,
+  0x17,0x11,0x13,0x2A,0x15,0x17,0x11,0x97,0x15,0x17,0x11,0x13,0x22,0x17,0x15,0x17,
+  0x11,0x14,0x12,0x17,0x16,0x16,0x11,0x17,0x16,0x17,0x16,0x11,0x17,0x16,0x17,0x16,
+  0x11,0x17,0x16,0x18,0x15,0x11,0x17,0x15,0x14,0xC1,0x95,0x1A,0x16,0x17,0x14,0x1C,
+  0x15,0x17,0x13,0x1E,0x1C,0x12,0x1F,0x12,0xA3,0xF4,0x35,0x3F,0x95,0x21,0xFF,0x11,
+  0xFF,0x11,0xFF,0xC0,                                                                 /* MOSFET dep n-ch */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x15,
+  0x17,0x13,0x1C,0x16,0x17,0x14,0x15,0xC1,0x95,0x19,0x15,0x11,0x17,0x15,0x18,0x16,
+  0x11,0x17,0x16,0x17,0x16,0x11,0x17,0x16,0x17,0x16,0x11,0x17,0x16,0x16,0x17,0x11,
+  0x13,0x13,0x17,0x15,0x17,0x11,0x13,0x22,0x17,0x15,0x17,0x11,0x97,0x15,0x17,0x11,
+  0x13,0x2A,0x15,0x17,0x11,0x13,0x1B,0x16,0x16,0x11,0x1E,0x17,0x16,0x11,0x1E,0x17,
+  0x16,0x11,0x1E,0x18,0x15,0x11,0x1D,0x19,0x15,0x11,0x95,0x1A,0x16,0x17,0x14,0x1C,
+  0x15,0x17,0x13,0x1E,0x1C,0x12,0x1F,0x12,0xA3,0xF4,0x35,0x3F,0x95,0x21,0xFF,0x11,
+  0xFF,0x11,0xFF,0xC0,                                                                 /* MOSFET dep p-ch */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x1D,
+  0x13,0x1C,0x16,0x17,0x14,0x1A,0x17,0x17,0x15,0x19,0x17,0x95,0x18,0x18,0x1E,0x17,
+  0x18,0x1E,0x17,0x18,0x1E,0x16,0x19,0x1F,0x01,0x51,0x91,0xF0,0x15,0x19,0x1F,0x01,
+  0x51,0x91,0xF0,0x15,0x19,0x1F,0x01,0x61,0x81,0xE1,0x71,0x51,0x21,0xE1,0x71,0x52,
+  0x11,0xE1,0x3F,0x75,0x19,0x14,0x21,0x17,0x15,0x1A,0x13,0x12,0x17,0x14,0x1C,0x1D,
+  0x13,0x1E,0x1C,0x12,0x1F,0x12,0xA3,0xF4,0x35,0x3F,0x95,0x21,0xFF,0x11,0xFF,0x11,
+  0xFF,0xC0,                                                                           /* JFET n-ch */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x1D,
+  0x13,0x1C,0x13,0x12,0x17,0x14,0x1A,0x13,0x22,0x17,0x15,0x14,0xF7,0x51,0x81,0x42,
+  0x21,0xE1,0x71,0x51,0x21,0xE1,0x71,0x81,0xE1,0x61,0x91,0xF0,0x15,0x19,0x1F,0x01,
+  0x51,0x91,0xF0,0x15,0x19,0x1F,0x01,0x51,0x91,0xF0,0x16,0x18,0x1E,0x17,0x18,0x1E,
+  0x17,0x18,0x1E,0x18,0x17,0x95,0x19,0x17,0x17,0x15,0x1A,0x16,0x17,0x14,0x1C,0x1D,
+  0x13,0x1E,0x1C,0x12,0x1F,0x12,0xA3,0xF4,0x35,0x3F,0x95,0x21,0xFF,0x11,0xFF,0x11,
+  0xFF,0xC0,                                                                           /* JFET p-ch */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x1D,
+  0x13,0x1C,0x15,0x17,0x15,0x1A,0x14,0x11,0x16,0x17,0x19,0x14,0x11,0x15,0x18,0x18,
+  0x15,0x11,0x14,0x1A,0x17,0x15,0x11,0x13,0x1B,0x17,0x15,0x11,0x12,0x1C,0x16,0x16,
+  0x11,0x11,0x1E,0x15,0x16,0x11,0x2F,0x01,0x2B,0x11,0xF1,0x15,0x16,0x11,0x2F,0x01,
+  0x51,0x61,0x11,0x11,0xE1,0x61,0x51,0x11,0x21,0xC1,0x71,0x51,0x11,0x31,0x21,0x81,
+  0x71,0x51,0x11,0x43,0x81,0x81,0x41,0x11,0x43,0x71,0x91,0x41,0x11,0x34,0x71,0xA1,
+  0x51,0x71,0x51,0xC1,0xD1,0x31,0xE1,0xC1,0x21,0xF1,0x2A,0x3F,0x43,0x53,0xF9,0x52,
+  0x1F,0xF1,0x1F,0xF1,0x1F,0xFC,                                                       /* IGBT enh n-ch */
+
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x1D,
+  0x13,0x1C,0x1D,0x15,0x1A,0x16,0x13,0x12,0x17,0x19,0x14,0x11,0x13,0x38,0x18,0x15,
+  0x11,0x13,0x39,0x17,0x15,0x11,0x13,0x48,0x17,0x15,0x11,0x12,0x1C,0x16,0x16,0x11,
+  0x11,0x1E,0x15,0x16,0x11,0x2F,0x01,0x2B,0x11,0xF1,0x15,0x16,0x11,0x2F,0x01,0x51,
+  0x61,0x11,0x11,0xE1,0x61,0x51,0x11,0x21,0xC1,0x71,0x51,0x11,0x31,0xB1,0x71,0x51,
+  0x11,0x41,0xA1,0x81,0x41,0x11,0x51,0x81,0x91,0x61,0x61,0x71,0xA1,0xD1,0x51,0xC1,
+  0xD1,0x31,0xE1,0xC1,0x21,0xF1,0x2A,0x3F,0x43,0x53,0xF9,0x52,0x1F,0xF1,0x1F,0xF1,
+  0x1F,0xFC,                                                                           /* IGBT enh p-ch */
+
+  0xFF,0xF3,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,
+  0x1F,0x7F,0x4E,0xF2,0xF1,0xF0,0xF3,0xDF,0x5B,0xF7,0x9F,0x97,0xFB,0x5F,0xD3,0xFF,
+  0x01,0xF7,0xF4,0xF6,0x2F,0xE1,0x11,0xFD,0x12,0x1F,0xC1,0x31,0xFB,0x14,0x1F,0xA1,
+  0x51,0xF1,0x96,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xFF,0x20,               /* SCR */
+
+  0xFF,0xF3,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,
+  0x1F,0xF1,0x1F,0x6F,0x6F,0x11,0x59,0xF1,0x34,0x9F,0x13,0x57,0xF1,0x54,0x7F,0x15,
+  0x55,0xF1,0x74,0x5F,0x17,0x53,0xF1,0x94,0x3F,0x19,0x51,0xF1,0xF6,0xF1,0x14,0x1F,
+  0xA1,0x51,0xF9,0x16,0x1F,0x81,0x71,0xF1,0x78,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,
+  0xF1,0x1F,0xF1,0x1F,0xFF,0x20,                                                       /* Triac */
+
+  0xFF,0xF3,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0x19,0x61,0xFA,0x15,0x1F,0xB1,0x41,
+  0xFC,0x13,0x1F,0xD1,0x21,0xFE,0x11,0x1F,0xF0,0x2F,0x7F,0x4E,0xF2,0xF1,0xF0,0xF3,
+  0xDF,0x5B,0xF7,0x9F,0x97,0xFB,0x5F,0xD3,0xFF,0x01,0xF7,0xF4,0xF7,0x1F,0xF1,0x1F,
+  0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xF1,0x1F,0xFF,0x20                /* PUT */
+
+  #ifdef SW_UJT
+  ,
+  0xF6,0x1F,0xF1,0x1F,0x95,0x21,0xF6,0x35,0x3F,0x42,0xA3,0xF1,0x1C,0x12,0x1E,0x1D,
+  0x13,0x1C,0x16,0x17,0x14,0x15,0x76,0x17,0x15,0x19,0x11,0x15,0x95,0x18,0x13,0x11,
+  0x12,0x1E,0x17,0x14,0x22,0x1E,0x17,0x13,0x32,0x1E,0x16,0x17,0x11,0x1F,0x01,0x51,
+  0x82,0xF0,0x15,0x19,0x1F,0x01,0x51,0x91,0xF0,0x15,0x19,0x1F,0x01,0x61,0x81,0xE1,
+  0x71,0x81,0xE1,0x71,0x81,0xE1,0x81,0x79,0x51,0x91,0x71,0x71,0x51,0xA1,0x61,0x71,
+  0x41,0xC1,0xD1,0x31,0xE1,0xC1,0x21,0xF1,0x2A,0x3F,0x43,0x53,0xF9,0x52,0x1F,0xF1,
+  0x1F,0xF1,0x1F,0xFC                                                                  /* UJT */
+  #endif
+};
+
+
+/* start of bitmaps in SymbolData */
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,        /* BJT npn */
+  103,      /* BJT pnp */
+  204,      /* MOSFET enh n-ch */
+  317,      /* MOSFET enh p-ch */
+  430,      /* MOSFET dep n-ch */
+  546,      /* MOSFET dep p-ch */
+  662,      /* JFET n-ch */
+  760,      /* JFET p-ch */
+  858,      /* IGBT enh n-ch */
+  976,      /* IGBT enh p-ch */
+  1090,     /* SCR */
+  1152,     /* Triac */
+  1222      /* PUT */
+  #ifdef SW_UJT
+  ,
+  1284      /* UJT */
+  #endif
+};
+
+
+
+/*
+ *  pin position lookup table
+ *  - one byte per pin and 3 bytes (pins) for each symbol
+ *  - cross reference for the Semi structure's pins:
+ *
+ *      BJT         FET         SCR         Triac       IGBT
+ *  ------------------------------------------------------------------
+ *  A   Base        Gate        Gate        Gate        Gate
+ *  B   Collector   Drain       Anode       MT2         Collector
+ *  C   Emitter     Source      Cathode     MT1         Emitter
+ *
+ *      PUT         UJT
+ *  ------------------------------------------------------------------
+ *  A   Gate        Emitter
+ *  B   Anode       B2
+ *  C   Cathode     B1
+ */
+
+const uint8_t PinTable[] PROGMEM = {
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* BJT npn */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,   /* BJT pnp */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* MOSFET enh n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* MOSFET enh p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* MOSFET dep n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* MOSFET dep p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* JFET n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* JFET p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* IGBT enh n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* IGBT enh p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* SCR */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* Triac */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM       /* PUT */
+  #ifdef SW_UJT
+  ,
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM       /* UJT */
+  #endif
+};
+
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
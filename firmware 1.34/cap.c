@@ -1387,6 +1387,8 @@ void MeasureCap(uint8_t Probe1, uint8_t Probe2, uint8_t ID)
 
   if (Check.Found == COMP_ERROR) return;    /* skip check on any error */
 
+  FlushOutput();              /* no output while measuring */
+
 
   /*
    *  Normaly we would skip resistors, but a resistor < 10 Ohms could be
@@ -0,0 +1,120 @@
+/* ************************************************************************
+ *
+ *   hash table for remote commands
+ *   generated by cmd_hash.py, do not edit
+ *
+ * ************************************************************************ */
+
+
+/* hash parameters */
+#define CMD_HASH_MUL          3    /* multiplier */
+#define CMD_HASH_SLOTS        64   /* number of slots */
+
+
+/* displacement per bucket (upper nibble of hash) */
+const uint8_t Cmd_Hash_Disp[16] PROGMEM = {
+  0, 0, 1, 1, 8, 3, 0, 2, 0, 0, 2, 0, 5, 0, 0, 5
+};
+
+
+/* slots: command ID and command string */
+const Cmd_Type Cmd_Hash_Table[CMD_HASH_SLOTS] PROGMEM = {
+  {CMD_I_R, "I_R"},           /* 0 */
+  {CMD_NONE, ""},             /* 1 */
+  {CMD_C_GE, "C_GE"},         /* 2 */
+  {CMD_NEXT, "NEXT"},         /* 3 */
+  {CMD_NONE, ""},             /* 4 */
+  #if defined (SW_UJT)
+  {CMD_R_BB, "R_BB"},         /* 5 */
+  #else
+  {CMD_NONE, ""},             /* 5 */
+  #endif
+  {CMD_NONE, ""},             /* 6 */
+  {CMD_NONE, ""},             /* 7 */
+  {CMD_R_BE, "R_BE"},         /* 8 */
+  {CMD_NONE, ""},             /* 9 */
+  {CMD_NONE, ""},             /* 10 */
+  {CMD_C, "C"},               /* 11 */
+  {CMD_NONE, ""},             /* 12 */
+  {CMD_PROBE, "PROBE"},       /* 13 */
+  {CMD_NONE, ""},             /* 14 */
+  {CMD_COMP, "COMP"},         /* 15 */
+  {CMD_C_GS, "C_GS"},         /* 16 */
+  #if defined (SW_STATISTICS)
+  {CMD_STAT, "STAT"},         /* 17 */
+  #else
+  {CMD_NONE, ""},             /* 17 */
+  #endif
+  {CMD_V_GT, "V_GT"},         /* 18 */
+  {CMD_I_DSS, "I_DSS"},       /* 19 */
+  #if defined (SW_INDUCTOR)
+  {CMD_L, "L"},               /* 20 */
+  #else
+  {CMD_NONE, ""},             /* 20 */
+  #endif
+  {CMD_R, "R"},               /* 21 */
+  {CMD_NONE, ""},             /* 22 */
+  {CMD_I_CEO, "I_CEO"},       /* 23 */
+  {CMD_NONE, ""},             /* 24 */
+  {CMD_NONE, ""},             /* 25 */
+  {CMD_I_L, "I_l"},           /* 26 */
+  {CMD_NONE, ""},             /* 27 */
+  {CMD_R_DS, "R_DS"},         /* 28 */
+  {CMD_NONE, ""},             /* 29 */
+  {CMD_NONE, ""},             /* 30 */
+  {CMD_OFF, "OFF"},           /* 31 */
+  {CMD_NONE, ""},             /* 32 */
+  {CMD_NONE, ""},             /* 33 */
+  {CMD_NONE, ""},             /* 34 */
+  {CMD_NONE, ""},             /* 35 */
+  {CMD_NONE, ""},             /* 36 */
+  {CMD_NONE, ""},             /* 37 */
+  {CMD_H_FE, "h_FE"},         /* 38 */
+  {CMD_HINT, "HINT"},         /* 39 */
+  {CMD_VER, "VER"},           /* 40 */
+  {CMD_V_F, "V_F"},           /* 41 */
+  {CMD_NONE, ""},             /* 42 */
+  {CMD_NONE, ""},             /* 43 */
+  {CMD_NONE, ""},             /* 44 */
+  {CMD_V_F2, "V_F2"},         /* 45 */
+  {CMD_V_TH, "V_th"},         /* 46 */
+  {CMD_QTY, "QTY"},           /* 47 */
+  #if defined (UI_SERIAL_TELEMETRY)
+  {CMD_PUSH, "PUSH"},         /* 48 */
+  #else
+  {CMD_NONE, ""},             /* 48 */
+  #endif
+  {CMD_NONE, ""},             /* 49 */
+  #if defined (UI_SERIAL_TELEMETRY)
+  {CMD_DATA, "DATA"},         /* 50 */
+  #else
+  {CMD_NONE, ""},             /* 50 */
+  #endif
+  {CMD_TYPE, "TYPE"},         /* 51 */
+  {CMD_NONE, ""},             /* 52 */
+  {CMD_NONE, ""},             /* 53 */
+  {CMD_V_BE, "V_BE"},         /* 54 */
+  #if defined (UI_SERIAL_TELEMETRY)
+  {CMD_NOPUSH, "NOPUSH"},     /* 55 */
+  #else
+  {CMD_NONE, ""},             /* 55 */
+  #endif
+  #if defined (SW_ESR) || defined (SW_OLD_ESR)
+  {CMD_ESR, "ESR"},           /* 56 */
+  #else
+  {CMD_NONE, ""},             /* 56 */
+  #endif
+  {CMD_V_T, "V_T"},           /* 57 */
+  {CMD_MSG, "MSG"},           /* 58 */
+  {CMD_NONE, ""},             /* 59 */
+  {CMD_C_D, "C_D"},           /* 60 */
+  {CMD_NONE, ""},             /* 61 */
+  {CMD_PIN, "PIN"},           /* 62 */
+  {CMD_NONE, ""}              /* 63 */
+};
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+# ************************************************************************
+#
+#   generator for the hash table of remote commands
+#
+#   (c) 2026 by agent
+#
+# ************************************************************************
+
+#
+#  hints:
+#  - creates a perfect hash table for the command strings of the remote
+#    commands (cmd_hash.h), which is included by commands.c
+#  - usage: cmd_hash.py <output header>
+#  - edit COMMANDS below to add or remove a command and run this script
+#    again
+#  - hash of a command string (8 bit, characters c):
+#      hash = hash * CMD_HASH_MUL + c
+#  - slot in table:
+#      slot = (hash + Cmd_Hash_Disp[hash >> 4]) & (CMD_HASH_SLOTS - 1)
+#  - the multiplier is chosen to give each command a unique hash, and
+#    the displacement per bucket (upper nibble of hash) is chosen to give
+#    each command a unique slot
+#  - optional commands are included always and their slots are filled
+#    based on the same condition as in commands.c
+#
+
+import sys
+
+
+# table size
+SLOTS = 64                              # slots (power of 2)
+BUCKETS = 16                            # buckets (upper nibble of hash)
+LENGTH = 7                              # max. length of command + 1
+
+# command string, command ID, condition (or None)
+COMMANDS = [
+  ('VER', 'CMD_VER', None),
+  ('PROBE', 'CMD_PROBE', None),
+  ('OFF', 'CMD_OFF', None),
+  ('COMP', 'CMD_COMP', None),
+  ('MSG', 'CMD_MSG', None),
+  ('QTY', 'CMD_QTY', None),
+  ('NEXT', 'CMD_NEXT', None),
+  ('TYPE', 'CMD_TYPE', None),
+  ('HINT', 'CMD_HINT', None),
+  ('PIN', 'CMD_PIN', None),
+  ('R', 'CMD_R', None),
+  ('C', 'CMD_C', None),
+  ('L', 'CMD_L', 'defined (SW_INDUCTOR)'),
+  ('ESR', 'CMD_ESR', 'defined (SW_ESR) || defined (SW_OLD_ESR)'),
+  ('I_l', 'CMD_I_L', None),
+  ('V_F', 'CMD_V_F', None),
+  ('V_F2', 'CMD_V_F2', None),
+  ('C_D', 'CMD_C_D', None),
+  ('I_R', 'CMD_I_R', None),
+  ('R_BE', 'CMD_R_BE', None),
+  ('h_FE', 'CMD_H_FE', None),
+  ('V_BE', 'CMD_V_BE', None),
+  ('I_CEO', 'CMD_I_CEO', None),
+  ('V_th', 'CMD_V_TH', None),
+  ('C_GS', 'CMD_C_GS', None),
+  ('R_DS', 'CMD_R_DS', None),
+  ('I_DSS', 'CMD_I_DSS', None),
+  ('C_GE', 'CMD_C_GE', None),
+  ('V_GT', 'CMD_V_GT', None),
+  ('V_T', 'CMD_V_T', None),
+  ('R_BB', 'CMD_R_BB', 'defined (SW_UJT)'),
+  ('STAT', 'CMD_STAT', 'defined (SW_STATISTICS)'),
+  ('DATA', 'CMD_DATA', 'defined (UI_SERIAL_TELEMETRY)'),
+  ('PUSH', 'CMD_PUSH', 'defined (UI_SERIAL_TELEMETRY)'),
+  ('NOPUSH', 'CMD_NOPUSH', 'defined (UI_SERIAL_TELEMETRY)'),
+]
+
+
+#
+#  8 bit hash of command string
+#
+
+def get_hash(cmd, mul):
+  value = 0
+  for char in cmd:
+    value = (value * mul + ord(char)) & 0xFF
+  return value
+
+
+#
+#  find multiplier with a unique hash for each command
+#
+
+def find_multiplier():
+  for mul in range(3, 256, 2):
+    hashes = set(get_hash(cmd, mul) for cmd, _, _ in COMMANDS)
+    if len(hashes) == len(COMMANDS):
+      return mul
+  sys.exit('error: no multiplier found')
+
+
+#
+#  find displacement for each bucket
+#  - largest buckets first
+#  - commands of a bucket differ in the lower nibble of the hash, so
+#    they never collide within the bucket
+#
+
+def find_displacement(mul):
+  buckets = [[] for _ in range(BUCKETS)]
+  for n, (cmd, _, _) in enumerate(COMMANDS):
+    value = get_hash(cmd, mul)
+    buckets[value >> 4].append((value, n))
+
+  disp = [0] * BUCKETS
+  slots = [None] * SLOTS
+
+  for b in sorted(range(BUCKETS), key=lambda b: -len(buckets[b])):
+    if not buckets[b]:
+      continue
+    for d in range(SLOTS):
+      used = [(value + d) & (SLOTS - 1) for value, _ in buckets[b]]
+      if all(slots[s] is None for s in used):
+        break
+    else:
+      sys.exit('error: no displacement found')
+    disp[b] = d
+    for s, (_, n) in zip(used, buckets[b]):
+      slots[s] = n
+
+  return disp, slots
+
+
+#
+#  main
+#
+
+def main():
+  if len(sys.argv) != 2:
+    sys.exit('usage: cmd_hash.py <output header>')
+
+  for cmd, _, _ in COMMANDS:
+    if len(cmd) >= LENGTH:
+      sys.exit('error: command too long (' + cmd + ')')
+
+  mul = find_multiplier()
+  disp, slots = find_displacement(mul)
+
+  out = '/* ************************************************************************\n'
+  out += ' *\n'
+  out += ' *   hash table for remote commands\n'
+  out += ' *   generated by cmd_hash.py, do not edit\n'
+  out += ' *\n'
+  out += ' * ************************************************************************ */\n'
+  out += '\n\n'
+  out += '/* hash parameters */\n'
+  out += '#define CMD_HASH_MUL'.ljust(30) + ('%d' % mul).ljust(5) + '/* multiplier */\n'
+  out += '#define CMD_HASH_SLOTS'.ljust(30) + ('%d' % SLOTS).ljust(5) + '/* number of slots */\n'
+  out += '\n\n'
+  out += '/* displacement per bucket (upper nibble of hash) */\n'
+  out += 'const uint8_t Cmd_Hash_Disp[%d] PROGMEM = {\n' % BUCKETS
+  out += '  ' + ', '.join('%d' % d for d in disp) + '\n'
+  out += '};\n'
+  out += '\n\n'
+  out += '/* slots: command ID and command string */\n'
+  out += 'const Cmd_Type Cmd_Hash_Table[CMD_HASH_SLOTS] PROGMEM = {\n'
+
+  for s in range(SLOTS):
+    sep = ',' if s < SLOTS - 1 else ''
+    empty = ('  {CMD_NONE, ""}' + sep).ljust(30) + '/* %d */\n' % s
+    n = slots[s]
+    if n is None:
+      out += empty
+      continue
+    cmd, ident, cond = COMMANDS[n]
+    entry = ('  {' + ident + ', "' + cmd + '"}' + sep).ljust(30) + '/* %d */\n' % s
+    if cond:
+      out += '  #if ' + cond + '\n'
+      out += entry
+      out += '  #else\n'
+      out += empty
+      out += '  #endif\n'
+    else:
+      out += entry
+
+  out += '};\n'
+  out += '\n\n\n'
+  out += '/* ************************************************************************\n'
+  out += ' *   EOF\n'
+  out += ' * ************************************************************************ */\n'
+
+  open(sys.argv[1], 'w', encoding='latin-1').write(out)
+
+  print('%s: %d commands in %d slots, multiplier %d' %
+        (sys.argv[1], len(COMMANDS), SLOTS, mul))
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+# ************************************************************************
+#
+#   simulator and benchmark for remote commands
+#
+#   (c) 2026 by agent
+#
+# ************************************************************************
+
+#
+#  hints:
+#  - simulator: creates a pseudo terminal which answers the remote
+#    commands like a tester with UI_SERIAL_COMMANDS, so host software can
+#    be developed without a tester
+#    - usage: cmd_sim.py sim [-b <baud>] [-d <delay>] [-m <model file>]
+#             [<model> ...]
+#    - the path of the pseudo terminal is printed at startup
+#    - each PROBE takes the next DUT model of the list (round robin)
+#    - the command set is taken from cmd_hash.py and the firmware version
+#      from variables.h, so they match the firmware
+#    - line handling as the firmware: CR is ignored, LF ends a line,
+#      lines longer than 32 chars return ERR, batches separated by ';'
+#    - binary telemetry isn't simulated (DATA returns ERR)
+#  - benchmark: sends a set of commands to a tester or the simulator,
+#    one per line and as batches, and measures commands per second and
+#    reply bytes
+#    - usage: cmd_sim.py bench [-b <baud>] [-n <rounds>] [-p] <device>
+#    - -p runs PROBE before the benchmark
+#  - DUT models are sections of an INI file, each key is a command and
+#    its value the reply, e.g.:
+#      [npn]
+#      COMP = 30
+#      PIN = EBC
+#    commands not listed return ERR (not supported for this component),
+#    use N/A for a value not available
+#  - requires python3 only (no pyserial)
+#
+
+import configparser
+import os
+import pty
+import re
+import select
+import sys
+import termios
+import time
+import tty
+
+import cmd_hash
+
+
+# firmware limits
+LINE_MAX = 32                           # max. chars of a command line
+SEPARATOR = ';'                         # separator for batches
+
+# commands not supported in a batch
+NO_BATCH = ('PROBE', 'OFF', 'STAT', 'DATA')
+
+# commands for benchmark
+BENCH_COMMANDS = ['COMP', 'QTY', 'PIN', 'R', 'C']
+
+# built-in DUT models (replies as sent by the firmware)
+MODELS = {
+  'resistor': {
+    'COMP': '10', 'QTY': '1', 'PIN': 'x-x', 'R': '4701R', 'L': 'N/A',
+  },
+  'capacitor': {
+    'COMP': '11', 'QTY': '1', 'PIN': 'x-x', 'C': '98.3nF', 'ESR': 'N/A',
+    'I_l': 'N/A',
+  },
+  'diode': {
+    'COMP': '20', 'QTY': '1', 'PIN': 'A-C', 'V_F': '654mV',
+    'V_F2': '387mV', 'C_D': '8pF', 'I_R': 'N/A',
+  },
+  'npn': {
+    'COMP': '30', 'QTY': '1', 'TYPE': 'NPN', 'HINT': '', 'PIN': 'EBC',
+    'h_FE': '234', 'V_BE': '657mV', 'I_CEO': 'N/A',
+  },
+  'mosfet': {
+    'COMP': '31', 'QTY': '1', 'TYPE': 'MOSFET n-ch enh.', 'HINT': 'D_FB',
+    'PIN': 'GDS', 'V_th': '2959mV', 'C_GS': '3200pF', 'R_DS': '1.20R',
+    'V_F': '742mV',
+  },
+}
+
+
+#
+#  get firmware version from variables.h
+#
+
+def get_version():
+  path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                      'variables.h')
+  text = open(path, encoding='latin-1').read()
+  match = re.search(r'Version_str\[\] EEMEM = "([^"]*)"', text)
+  if match is None:
+    sys.exit('error: Version_str not found')
+  return match.group(1)
+
+
+#
+#  load DUT models from INI file
+#
+
+def load_models(path):
+  parser = configparser.ConfigParser(interpolation=None)
+  parser.optionxform = str              # commands are case sensitive
+  if not parser.read(path):
+    sys.exit('error: can\'t read ' + path)
+  for name in parser.sections():
+    MODELS[name] = dict(parser.items(name))
+
+
+#
+#  set terminal to raw mode and baud rate
+#
+
+def set_raw(fd, baud):
+  tty.setraw(fd)
+  if baud:
+    speed = getattr(termios, 'B%d' % baud, None)
+    if speed is None:
+      sys.exit('error: unsupported baud rate ' + str(baud))
+    attr = termios.tcgetattr(fd)
+    attr[4] = speed                     # input speed
+    attr[5] = speed                     # output speed
+    termios.tcsetattr(fd, termios.TCSANOW, attr)
+
+
+#
+#  simulated tester
+#
+
+class Tester:
+
+  def __init__(self, models, delay):
+    self.commands = set(cmd for cmd, _, _ in cmd_hash.COMMANDS)
+    self.version = get_version()
+    self.models = models
+    self.delay = delay
+    self.next = 0                       # next model to probe
+    self.comp = {'COMP': '0', 'QTY': '0'}    # nothing probed yet
+    self.off = False
+
+  # run a single command and return its reply (None: no reply)
+  def run(self, cmd, batch):
+    if cmd not in self.commands:
+      return 'ERR'
+    if batch and cmd in NO_BATCH:
+      return 'ERR'
+
+    if cmd == 'VER':
+      return self.version
+    if cmd == 'OFF':
+      self.off = True
+      return 'OK'
+    if cmd == 'PROBE':
+      time.sleep(self.delay)            # probing takes some time
+      self.comp = MODELS[self.models[self.next]]
+      self.next = (self.next + 1) % len(self.models)
+      return 'OK'
+    if cmd in ('PUSH', 'NOPUSH'):
+      return 'OK'
+    if cmd == 'NEXT':
+      if self.comp.get('QTY') == '2':
+        return 'OK'
+      return 'N/A'
+    if cmd == 'STAT':
+      return self.comp.get('STAT', 'N/A')
+
+    return self.comp.get(cmd, 'ERR')
+
+  # process a command line and return the reply line
+  def line(self, text):
+    if len(text) > LINE_MAX:            # buffer overflow
+      return 'ERR'
+    if SEPARATOR in text:               # batch
+      return SEPARATOR.join(self.run(cmd, True)
+                            for cmd in text.split(SEPARATOR))
+    return self.run(text, False)
+
+
+#
+#  simulator
+#
+
+def simulate(args):
+  baud = 0
+  delay = 0.5
+  names = []
+
+  while args:
+    arg = args.pop(0)
+    if arg == '-b':
+      baud = int(args.pop(0))
+    elif arg == '-d':
+      delay = float(args.pop(0))
+    elif arg == '-m':
+      load_models(args.pop(0))
+    else:
+      names.append(arg)
+
+  if not names:
+    names = list(MODELS)
+  for name in names:
+    if name not in MODELS:
+      sys.exit('error: unknown model ' + name)
+
+  tester = Tester(names, delay)
+  master, slave = pty.openpty()
+  set_raw(slave, 0)
+  print('tester at %s, models: %s' % (os.ttyname(slave), ' '.join(names)))
+  sys.stdout.flush()
+
+  line = b''
+  while not tester.off:
+    select.select([master], [], [])
+    try:
+      data = os.read(master, 256)
+    except OSError:                     # no reader connected
+      time.sleep(0.1)
+      continue
+
+    for char in data:
+      if char == 0x0D:                  # CR: ignore
+        continue
+      if char != 0x0A:                  # any other char
+        line += bytes([char])
+        continue
+      if not line:                      # empty line: ignore
+        continue
+
+      reply = tester.line(line.decode('latin-1'))
+      line = b''
+      out = (reply + '\r\n').encode('latin-1')
+      os.write(master, out)
+      if baud:                          # emulate serial line (8N1)
+        time.sleep(len(out) * 10 / baud)
+
+  time.sleep(1)                         # let the last reply pass
+
+
+#
+#  read reply line
+#
+
+def read_line(fd, timeout):
+  line = b''
+  end = time.time() + timeout
+  while not line.endswith(b'\n'):
+    left = end - time.time()
+    if left <= 0 or not select.select([fd], [], [], left)[0]:
+      sys.exit('error: timeout')
+    line += os.read(fd, 1)
+  return line
+
+
+#
+#  send commands and measure time
+#
+
+def run_bench(fd, lines, rounds):
+  count = 0
+  size = 0
+  start = time.time()
+  for _ in range(rounds):
+    for text in lines:
+      os.write(fd, (text + '\n').encode('latin-1'))
+      size += len(read_line(fd, 2))
+      count += text.count(SEPARATOR) + 1
+  return count, size, time.time() - start
+
+
+#
+#  benchmark
+#
+
+def benchmark(args):
+  baud = 0
+  rounds = 100
+  probe = False
+  device = None
+
+  while args:
+    arg = args.pop(0)
+    if arg == '-b':
+      baud = int(args.pop(0))
+    elif arg == '-n':
+      rounds = int(args.pop(0))
+    elif arg == '-p':
+      probe = True
+    else:
+      device = arg
+
+  if device is None:
+    sys.exit('usage: cmd_sim.py bench [-b <baud>] [-n <rounds>] [-p] <device>')
+
+  fd = os.open(device, os.O_RDWR | os.O_NOCTTY)
+  set_raw(fd, baud)
+  termios.tcflush(fd, termios.TCIOFLUSH)
+
+  if probe:
+    os.write(fd, b'PROBE\n')
+    read_line(fd, 30)
+
+  tests = [('single', BENCH_COMMANDS),
+           ('batch', [SEPARATOR.join(BENCH_COMMANDS)])]
+
+  for name, lines in tests:
+    count, size, seconds = run_bench(fd, lines, rounds)
+    print('%-7s %5d commands in %.2fs: %7.1f commands/s, '
+          '%6d reply bytes (%.0f bytes/s)' %
+          (name, count, seconds, count / seconds, size, size / seconds))
+
+  os.close(fd)
+
+
+#
+#  main
+#
+
+def main():
+  if len(sys.argv) < 2 or sys.argv[1] not in ('sim', 'bench'):
+    sys.exit('usage: cmd_sim.py sim|bench ...')
+
+  if sys.argv[1] == 'sim':
+    simulate(sys.argv[2:])
+  else:
+    benchmark(sys.argv[2:])
+
+
+if __name__ == '__main__':
+  main()
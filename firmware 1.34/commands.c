@@ -43,6 +43,7 @@
 #include "common.h"           /* common header file */
 #include "variables.h"        /* global variables */
 #include "functions.h"        /* external functions */
+#include "cmd_hash.h"         /* hash table for commands */
 
 
 /*
@@ -51,6 +52,16 @@
 
 /* control logic */
 uint8_t             FirstFlag;     /* multiple strings in a line */
+uint8_t             BatchFlag;     /* running batch of commands */
+uint8_t             CmdPos;        /* start of command in RX line */
+
+/* used by GetCommand() */
+void RunBatch(void);
+
+#ifdef UI_SERIAL_TELEMETRY
+/* binary telemetry */
+uint16_t            TeleCRC;       /* CRC of current frame */
+#endif
 
 
 
@@ -1305,6 +1316,187 @@ uint8_t Cmd_V_T(void)
 
 
 
+#ifdef SW_STATISTICS
+
+/*
+ *  command: STAT
+ *  - probe component repeatedly and return statistics
+ *  - one line per value: name, samples, mean, min, max, std. deviation
+ *  - invalidates the last probing result
+ *
+ *  returns:
+ *  - SIGNAL_NA on n/a
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_STAT(void)
+{
+  uint8_t           Flag = SIGNAL_NA;   /* return value */
+  uint8_t           n;                  /* counter */
+  Stat_Type         Stats[NUM_STATS];   /* statistics */
+
+  Stats_Run(Stats, STATS_SERIAL);       /* collect values */
+
+  n = 0;
+  while (n < NUM_STATS)
+  {
+    if (Stats[n].Count > 0)             /* got values */
+    {
+      if (Flag == SIGNAL_OK)            /* not first line */
+      {
+        Serial_NewLine();               /* send newline */
+      }
+
+      Stats_Show(&Stats[n], STATS_SERIAL);   /* send values */
+      Flag = SIGNAL_OK;
+    }
+    n++;
+  }
+
+  /* component data doesn't match the displayed result anymore */
+  Check.Found = COMP_NONE;
+
+  return Flag;
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   binary telemetry
+ * ************************************************************************ */
+
+
+#ifdef UI_SERIAL_TELEMETRY
+
+/*
+ *  send byte of telemetry frame
+ *  - bypasses character conversion of Serial_Char()
+ *  - updates CRC (CRC-16/CCITT: polynomial 0x1021, start value 0xFFFF)
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Tele_Byte(uint8_t Byte)
+{
+  TeleCRC = _crc_xmodem_update(TeleCRC, Byte);     /* update CRC */
+  Serial_WriteByte(Byte);                          /* send byte */
+}
+
+
+
+/*
+ *  send value of telemetry frame
+ *  - LSB first (little endian)
+ *
+ *  requires:
+ *  - Value: value to send
+ *  - Bytes: number of bytes (1-4)
+ */
+
+void Tele_Value(uint32_t Value, uint8_t Bytes)
+{
+  while (Bytes > 0)
+  {
+    Tele_Byte((uint8_t)Value);     /* send LSB */
+    Value >>= 8;                   /* next byte */
+    Bytes--;
+  }
+}
+
+
+
+/*
+ *  send probing result as binary frame
+ *  - frame:
+ *    sync (0xAA), payload size, type, payload, CRC-16 (LSB first)
+ *    CRC covers payload size, type and payload
+ *  - payload (fixed layout, see README):
+ *    Check, Resistors[3], Caps[3], Diodes[6], Semi
+ *    values as raw fixed-point values with exponent (scale)
+ */
+
+void Tele_Result(void)
+{
+  uint8_t           n;             /* counter */
+  Resistor_Type     *Resistor;     /* pointer to resistor */
+  Capacitor_Type    *Cap;          /* pointer to cap */
+  Diode_Type        *Diode;        /* pointer to diode */
+
+  /* header */
+  Serial_WriteByte(TELE_SYNC);     /* start of frame */
+  TeleCRC = 0xFFFF;                /* start value of CRC */
+  Tele_Byte(TELE_RESULT_SIZE);     /* payload size */
+  Tele_Byte(TELE_RESULT);          /* frame type */
+
+  /* check: 9 bytes */
+  Tele_Byte(Check.Found);          /* component type */
+  Tele_Byte(Check.Type);           /* subtype */
+  Tele_Byte(Check.Done);           /* transistor detection state */
+  Tele_Byte(Check.AltFound);       /* alternative component type */
+  Tele_Byte(Check.Resistors);      /* number of resistors */
+  Tele_Byte(Check.Diodes);         /* number of diodes */
+  Tele_Byte(Check.Probe);          /* error: probe pin */
+  Tele_Value(Check.U, 2);          /* error: voltage (mV) */
+
+  /* resistors: 3 * 7 bytes */
+  Resistor = &Resistors[0];
+  for (n = 0; n < 3; n++)
+  {
+    Tele_Byte(Resistor->A);             /* probe pin #1 */
+    Tele_Byte(Resistor->B);             /* probe pin #2 */
+    Tele_Byte(Resistor->Scale);         /* exponent */
+    Tele_Value(Resistor->Value, 4);     /* resistance */
+    Resistor++;                         /* next one */
+  }
+
+  /* caps: 3 * 11 bytes */
+  Cap = &Caps[0];
+  for (n = 0; n < 3; n++)
+  {
+    Tele_Byte(Cap->A);                  /* probe pin #1 */
+    Tele_Byte(Cap->B);                  /* probe pin #2 */
+    Tele_Byte(Cap->Scale);              /* exponent */
+    Tele_Value(Cap->Value, 4);          /* capacitance */
+    Tele_Value(Cap->I_leak, 4);         /* leakage current (10nA) */
+    Cap++;                              /* next one */
+  }
+
+  /* diodes: 6 * 6 bytes */
+  Diode = &Diodes[0];
+  for (n = 0; n < 6; n++)
+  {
+    Tele_Byte(Diode->A);                /* anode */
+    Tele_Byte(Diode->C);                /* cathode */
+    Tele_Value(Diode->V_f, 2);          /* V_f (mV) */
+    Tele_Value(Diode->V_f2, 2);         /* V_f low current (mV) */
+    Diode++;                            /* next one */
+  }
+
+  /* semi: 21 bytes (see Semi_Type for mapping) */
+  Tele_Byte(Semi.A);               /* pin A */
+  Tele_Byte(Semi.B);               /* pin B */
+  Tele_Byte(Semi.C);               /* pin C */
+  Tele_Value(Semi.U_1, 2);         /* voltage #1 */
+  Tele_Value(Semi.U_2, 2);         /* voltage #2 (signed) */
+  Tele_Value(Semi.F_1, 4);         /* factor #1 */
+  Tele_Value(Semi.I_value, 4);     /* current */
+  Tele_Byte(Semi.I_scale);         /* exponent */
+  Tele_Value(Semi.C_value, 4);     /* capacitance */
+  Tele_Byte(Semi.C_scale);         /* exponent */
+
+  /* CRC (LSB first), not covered by itself */
+  n = (uint8_t)(TeleCRC >> 8);     /* save MSB */
+  Serial_WriteByte((uint8_t)TeleCRC);
+  Serial_WriteByte(n);
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   command parsing and processing
  * ************************************************************************ */
@@ -1312,6 +1504,10 @@ uint8_t Cmd_V_T(void)
 
 /*
  *  check RX buffer for known command
+ *  - hashes the command and compares it with the single candidate
+ *    in the hash table (flash), so the lookup time doesn't depend on
+ *    the number of commands
+ *  - command starts at CmdPos and ends with 0 or CMD_SEPARATOR
  *
  *  returns:
  *  - command ID
@@ -1320,62 +1516,54 @@ uint8_t Cmd_V_T(void)
 uint8_t FindCommand(void)
 {
   uint8_t           ID = CMD_NONE;      /* command ID */
-  uint8_t           Flag = 1;           /* loop control flag */
-  uint8_t           n;                  /* counter */
-  uint8_t           CmdID;              /* command ID */
+  uint8_t           Hash = 0;           /* hash value */
+  uint8_t           n = 0;              /* counter */
   char              CmdChar;            /* single character */
-  unsigned char     *CmdAddr;           /* address of command string */
-  Cmd_Type          *Data;              /* address of table entry */
-  uint8_t           *Addr;              /* address pointer */
+  char              RX_Char;            /* single character of command */
+  char              *Cmd;               /* command in RX buffer */
+  const Cmd_Type    *Slot;              /* slot of hash table */
 
-  /*
-   *  Compare command in RX buffer with command strings referenced by
-   *  a stored table.
-   */
+  Cmd = &RX_Buffer[RX_Head][CmdPos];    /* command string */
 
-  Data = (Cmd_Type *)&Cmd_Table;   /* start address of table */
+  /* hash command string */
+  while ((Cmd[n] != 0) && (Cmd[n] != CMD_SEPARATOR))
+  {
+    Hash = Hash * CMD_HASH_MUL + Cmd[n];
+    n++;
+  }
 
-  while (Flag)                /* loop through table entries */
+  if (n < CMD_LENGTH)              /* not too long */
   {
-    /* read entry from reference table */
-    Addr = (uint8_t *)Data;             /* start of current entry */
-    CmdID = eeprom_read_byte(Addr);     /* read command ID */
-    Addr++;                             /* for next data field */
-    /* read string address */
-    CmdAddr = (unsigned char *)eeprom_read_word((uint16_t *)Addr);
+    /* get slot: add displacement of bucket (upper nibble) */
+    Hash += pgm_read_byte(&Cmd_Hash_Disp[Hash >> 4]);
+    Slot = &Cmd_Hash_Table[Hash & (CMD_HASH_SLOTS - 1)];
+    ID = pgm_read_byte(&Slot->ID);      /* read command ID */
 
-    if (CmdID)                /* valid command ID */
+    if (ID != CMD_NONE)            /* slot in use */
     {
       /* read and compare characterwise */
       n = 0;
-      while (n < RX_BUFFER_SIZE)        /* loop through string */
+      while (n < CMD_LENGTH)            /* loop through string */
       {
-        CmdChar = eeprom_read_byte(CmdAddr);      /* read char */
+        CmdChar = pgm_read_byte(&Slot->Cmd[n]);   /* read char */
+        RX_Char = Cmd[n];
+        if (RX_Char == CMD_SEPARATOR) RX_Char = 0;     /* end of command */
 
-        if (CmdChar == RX_Buffer[n])    /* match */
+        if (CmdChar != RX_Char)         /* mismatch */
         {
-          if (CmdChar == 0)             /* end of string */
-          {
-            n = RX_BUFFER_SIZE;         /* end string loop */
-            Flag = 0;                   /* end table loop */
-            ID = CmdID;                 /* found command */
-          }
-
-          n++;                          /* next char */
-          CmdAddr++;                    /* next char */
+          ID = CMD_NONE;                /* unknown command */
+          n = CMD_LENGTH;               /* end loop */
         }
-        else                            /* mismatch */
+        else if (CmdChar == 0)          /* end of string */
         {
-          n = RX_BUFFER_SIZE;           /* end string loop */
+          n = CMD_LENGTH;               /* found command, end loop */
+        }
+        else                            /* match */
+        {
+          n++;                          /* next char */
         }
       }
     }
-    else                      /* reached end of table */
-    {
-      Flag = 0;                         /* end table loop */
-    }
-
-    Data++;                             /* next entry */
   }
 
   return ID;
@@ -1393,26 +1581,46 @@ uint8_t FindCommand(void)
 uint8_t GetCommand(void)
 {
   uint8_t           ID = CMD_NONE;      /* command ID */
+  uint8_t           Flag = 1;           /* control flag */
+  uint8_t           n = 0;              /* counter */
+  char              *Line;              /* RX line */
 
-  /* check for locked RX buffer */
-  if (Cfg.OP_Control & OP_RX_LOCKED)    /* buffer locked */
+  /* check RX line queue */
+  if (RX_Dropped > 0)                   /* lost line is due (queue was full) */
+  {
+    Display_EEString_NL(Cmd_ERR_str);        /* send: ERR & newline */
+    Serial_RX_Done();                   /* remove lost line */
+  }
+  else if (RX_Lines > 0)                /* got line */
   {
     /* check if we don't have a overflow */
-    if (! (Cfg.OP_Control & OP_RX_OVERFLOW))   /* no buffer overflow */
+    if (! (RX_Overflow & (1 << RX_Head)))    /* no buffer overflow */
     {
-      /* check for command */
-      ID = FindCommand();               /* get command */
+      /* look for separator */
+      Line = &RX_Buffer[RX_Head][0];
+      while ((Line[n] != 0) && (Line[n] != CMD_SEPARATOR)) n++;
+
+      CmdPos = 0;                       /* first command */
+
+      if (Line[n] == CMD_SEPARATOR)     /* batch of commands */
+      {
+        RunBatch();                     /* run commands */
+        Flag = 0;                       /* replies are sent already */
+      }
+      else                              /* single command */
+      {
+        /* check for command */
+        ID = FindCommand();             /* get command */
+      }
     }
     /* else: overflow triggers output of error */
 
-    if (ID == CMD_NONE)                 /* no command found */
+    if ((ID == CMD_NONE) && Flag)       /* no command found */
     {
       Display_EEString_NL(Cmd_ERR_str);      /* send: ERR & newline */
     }
 
-    /* unlock buffer and clear overflow flag */
-    RX_Pos = 0;                         /* reset position */
-    Cfg.OP_Control &= (~OP_RX_LOCKED & ~OP_RX_OVERFLOW);
+    Serial_RX_Done();                   /* remove line from queue */
   }
 
   return ID;
@@ -1435,6 +1643,21 @@ uint8_t RunCommand(uint8_t ID)
   uint8_t           Key = KEY_NONE;     /* virtual key */
   uint8_t           Flag = SIGNAL_OK;   /* result of command function */
 
+  /*
+   *  batch: commands with a virtual key or more than a single line
+   *  of text aren't supported
+   */
+
+  if (BatchFlag)
+  {
+    if ((ID == CMD_PROBE) || (ID == CMD_OFF) ||
+        (ID == CMD_STAT) || (ID == CMD_DATA))
+    {
+      ID = CMD_NONE;                    /* signal error */
+    }
+  }
+
+
   /*
    *  run command
    */
@@ -1571,6 +1794,29 @@ uint8_t RunCommand(uint8_t ID)
       Flag = Cmd_V_T();                      /* run command */
       break;
 
+    #ifdef SW_STATISTICS
+    case CMD_STAT:            /* return statistics */
+      Flag = Cmd_STAT();                     /* run command */
+      break;
+    #endif
+
+    #ifdef UI_SERIAL_TELEMETRY
+    case CMD_DATA:            /* return probing result (binary) */
+      Tele_Result();                         /* send frame */
+      Flag = SIGNAL_NONE;                    /* no newline */
+      break;
+
+    case CMD_PUSH:            /* push probing result */
+      Cfg.OP_Mode |= OP_PUSH;                /* enable push */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+
+    case CMD_NOPUSH:          /* stop pushing probing result */
+      Cfg.OP_Mode &= ~OP_PUSH;               /* disable push */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+    #endif
+
     default:                  /* unknown/unsupported */
       Flag = SIGNAL_ERR;                     /* signal error */
       break;
@@ -1590,8 +1836,8 @@ uint8_t RunCommand(uint8_t ID)
     Display_EEString(Cmd_NA_str);       /* send: N/A */
   }
 
-  /* end line by sending newline */
-  if (Flag != SIGNAL_NONE)         /* valid response */
+  /* end line by sending newline (batch: after last command) */
+  if ((Flag != SIGNAL_NONE) && (! BatchFlag))     /* valid response */
   {
     Serial_NewLine();                   /* send newline */
   }
@@ -1601,6 +1847,59 @@ uint8_t RunCommand(uint8_t ID)
 
 
 
+/*
+ *  run batch of commands
+ *  - commands in RX line are separated by CMD_SEPARATOR
+ *  - replies are sent in a single line, separated by CMD_SEPARATOR
+ *  - each command gets its own reply, ERR for an unknown command
+ *    or a command not supported in a batch
+ */
+
+void RunBatch(void)
+{
+  uint8_t           ID;                 /* command ID */
+  uint8_t           Flag = 1;           /* loop control flag */
+  char              *Line;              /* RX line */
+
+  Line = &RX_Buffer[RX_Head][0];
+  BatchFlag = 1;                        /* enter batch mode */
+
+  while (Flag)                /* loop through commands */
+  {
+    ID = FindCommand();                 /* get command at CmdPos */
+
+    if (ID == CMD_NONE)                 /* no command found */
+    {
+      Display_EEString(Cmd_ERR_str);    /* send: ERR */
+    }
+    else                                /* run command */
+    {
+      RunCommand(ID);                   /* sends reply without newline */
+    }
+
+    /* move to next command */
+    while ((Line[CmdPos] != 0) && (Line[CmdPos] != CMD_SEPARATOR))
+    {
+      CmdPos++;
+    }
+
+    if (Line[CmdPos] == CMD_SEPARATOR)  /* another command */
+    {
+      CmdPos++;                         /* skip separator */
+      Display_Char(CMD_SEPARATOR);      /* send separator */
+    }
+    else                                /* end of line */
+    {
+      Flag = 0;                         /* end loop */
+    }
+  }
+
+  Serial_NewLine();                     /* send newline */
+  BatchFlag = 0;                        /* leave batch mode */
+}
+
+
+
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
@@ -23,6 +23,7 @@
 /* AVR */
 #include <avr/io.h>
 #include <util/delay.h>
+#include <util/crc16.h>
 #include <avr/sleep.h>
 #include <avr/eeprom.h>
 #include <avr/pgmspace.h>
@@ -72,13 +73,14 @@
 #define OP_EXT_REF            0b00000100     /* external voltage reference used */
 #define OP_SPI                0b00001000     /* SPI is set up */
 #define OP_I2C                0b00010000     /* I2C is set up */
+#define OP_PUSH               0b00100000     /* push telemetry after probing */
 
 /* operation control/signaling flags (bitmask) */
 #define OP_BREAK_KEY          0b00000001     /* exit key processing */
 #define OP_OUT_LCD            0b00000010     /* output to LCD display */
 #define OP_OUT_SER            0b00000100     /* output to TTL serial */
-#define OP_RX_LOCKED          0b00001000     /* RX buffer locked */
-#define OP_RX_OVERFLOW        0b00010000     /* RX buffer overflow */
+#define OP_RX_CMD             0b00001000     /* process remote commands */
+#define OP_DISCHARGED         0b00010000     /* probes were pulled down already */
 
 
 /* UI line modes (bitmask) */
@@ -87,11 +89,25 @@
 #define LINE_KEEP             0b00000010     /* keep first line */
 
 
+/* screen buffer flush modes */
+#define SHADOW_UPDATE         1    /* send changes only */
+#define SHADOW_DONE           2    /* send changes and finish screen */
+
+
 /* storage modes */
 #define STORAGE_LOAD          1    /* load adjustment values */
 #define STORAGE_SAVE          2    /* save adjustment values */
 
 
+/* statistics output modes */
+#define STATS_LCD             1    /* display: progress and one value per line */
+#define STATS_SERIAL          2    /* remote command: all values in one line */
+
+
+/* ADC stream: mode flags (lower bits: probe) */
+#define STREAM_8BIT           0b10000000     /* 8 bit samples (fast mode) */
+
+
 /* SPI */
 /* clock rate bitmask */
 #define SPI_CLOCK_R0          0b00000001     /* divider bit 0 (SPR0) */
@@ -108,6 +124,7 @@
 #define I2C_ADDRESS           2              /* address byte */
 #define I2C_ACK               1              /* acknowledge */
 #define I2C_NACK              2              /* not-acknowledge */
+#define I2C_BUSY              3              /* transaction running */
 
 
 /* TTL serial */
@@ -115,6 +132,10 @@
 #define SER_RX_PAUSE          1              /* pause RX */
 #define SER_RX_RESUME         2              /* resume RX */
 
+/* state of RX line */
+#define RX_LINE_OVERFLOW      0b00000001     /* line too long */
+#define RX_LINE_LOST          0b00000010     /* line lost (queue full) */
+
 /* special characters */
 #define CHAR_XON              17             /* software flow control: XON */
 #define CHAR_XOFF             19             /* software flow control: XOFF */
@@ -128,7 +149,9 @@
 
 /* buffer sizes */
 #define OUT_BUFFER_SIZE      12    /* 11 chars + terminating 0 */
-#define RX_BUFFER_SIZE       11    /* 10 chars + terminating 0 */
+#define RX_BUFFER_SIZE       33    /* 32 chars + terminating 0 */
+#define RX_LINES              4    /* queued RX lines (max. 8) */
+#define STREAM_SAMPLES       32    /* ADC stream: samples per half (multiple of 4) */
 
 /* number of entries in data tables */
 #define NUM_PREFIXES          7    /* unit prefixes */
@@ -137,6 +160,9 @@
 #define NUM_PWM_FREQ          8    /* PWM frequencies */
 #define NUM_INDUCTOR          32   /* inductance factors */
 #define NUM_TIMER1            5    /* Timer1 prescalers and bits */
+#define NUM_SORT_BINS         4    /* sorter tolerance bins */
+#define NUM_STATS             2    /* values for statistics */
+#define NUM_STREAM_RATES      3    /* ADC stream sample rates */
 
 
 
@@ -184,6 +210,40 @@
 #define CMD_V_GT              36    /* return V_GT */
 #define CMD_V_T               37    /* return V_T */
 #define CMD_R_BB              38    /* return R_BB */
+#define CMD_STAT              39    /* return statistics of repeated probing */
+#define CMD_DATA              40    /* return probing result (binary) */
+#define CMD_PUSH              41    /* push probing result after each cycle */
+#define CMD_NOPUSH            42    /* stop pushing probing result */
+
+
+/*
+ *  command strings
+ *  - hash table is generated by cmd_hash.py (cmd_hash.h)
+ */
+
+#define CMD_LENGTH            7     /* max. length of command string + 1 */
+
+
+/* batch of commands in a single line */
+#define CMD_SEPARATOR         ';'   /* separator for commands and replies */
+
+
+/*
+ *  binary telemetry
+ *  - frame: sync, length, type, payload, CRC-16
+ */
+
+/* frame */
+#define TELE_SYNC             0xAA  /* start of frame */
+
+/* frame types */
+#define TELE_RESULT           1     /* probing result */
+#define TELE_STREAM           2     /* raw ADC samples */
+
+/* payload sizes */
+#define TELE_RESULT_SIZE      120   /* probing result */
+#define TELE_STREAM_SIZE      (2 + STREAM_SAMPLES * 5 / 4)   /* 10 bit samples */
+#define TELE_STREAM_SIZE_8    (2 + STREAM_SAMPLES)           /* 8 bit samples */
 
 
 
@@ -332,6 +392,12 @@
 #define PIN_TOP               0b00001000     /* top */
 
 
+/* decoder state for run-length encoded bitmaps (bit mask) */
+#define RLE_LOW               0b00000001     /* low nibble is next */
+#define RLE_FG                0b00000010     /* foreground color */
+#define RLE_TOGGLE            0b00000100     /* toggle color for next run */
+
+
 
 /* ************************************************************************
  *   constants for additional hardware
@@ -396,6 +462,30 @@ typedef struct
 } Touch_Type;
 
 
+/* bin sorter reference (stored in EEPROM) */
+typedef struct
+{
+  uint8_t           Type;          /* component type (COMP_*) */
+  int8_t            Scale;         /* exponent of factor (value * 10^x) */
+  uint32_t          Value;         /* nominal value */
+  uint8_t           CheckSum;      /* checksum for stored values */
+} Sort_Type;
+
+
+/* statistics of repeated measurements */
+typedef struct
+{
+  const unsigned char    *Name;    /* storage address of name string */
+  unsigned char     Unit;          /* unit character */
+  int8_t            Scale;         /* exponent of factor (value * 10^x) */
+  uint8_t           Count;         /* number of samples */
+  uint16_t          Min;           /* minimum */
+  uint16_t          Max;           /* maximum */
+  int32_t           Mean;          /* running mean (in 1/16) */
+  uint32_t          M2;            /* sum of squared differences (in 1/256) */
+} Stat_Type;
+
+
 /* user interface */
 typedef struct
 {
@@ -628,11 +718,25 @@ typedef struct
 } I2C_Type;
 
 
-/* remote command */
+/* I2C transaction (interrupt driven TWI) */
+typedef struct
+{
+  uint8_t           Address;       /* slave address (7 bit) */
+  uint8_t           *Head;         /* header bytes to send first */
+  uint8_t           HeadCount;     /* number of header bytes */
+  uint8_t           *TX_Data;      /* data bytes to send */
+  uint8_t           TX_Count;      /* number of data bytes to send */
+  uint8_t           *RX_Data;      /* buffer for bytes to read */
+  uint8_t           RX_Count;      /* number of bytes to read */
+  volatile uint8_t  State;         /* state of transaction */
+} I2C_Transaction_Type;
+
+
+/* remote command (slot of hash table in flash) */
 typedef struct
 {
-  uint8_t                ID;       /* command ID */
-  const unsigned char    *Cmd;     /* storage address of command string */
+  uint8_t                ID;                 /* command ID */
+  char                   Cmd[CMD_LENGTH];    /* command string */
 } Cmd_Type;
 
 
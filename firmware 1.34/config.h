@@ -333,6 +333,47 @@
 #define SW_CAP_LEAKAGE
 
 
+/*
+ *  bin sorter for production batches
+ *  - sorts resistors, capacitors and BJTs (hFE) into tolerance bins
+ *    around a reference value taught by a sample part
+ *  - resistors and capacitors: probe #1 and probe #3
+ *  - BJTs: any pinout
+ *  - reference value is stored in EEPROM
+ *  - with UI_SERIAL_COPY each verdict is also sent as a compact record
+ *  - uncomment to enable
+ */
+
+//#define SW_SORTER
+
+
+/*
+ *  statistics for repeated measurements
+ *  - probes the same part STATS_RUNS times and shows mean, min, max and
+ *    standard deviation of its main values
+ *  - STATS_RUNS: 2-250
+ *  - with UI_SERIAL_COMMANDS also available via remote command (STAT)
+ *  - uncomment to enable
+ */
+
+//#define SW_STATISTICS
+#define STATS_RUNS            20
+
+
+/*
+ *  raw ADC stream via TTL serial
+ *  - samples probe #1, #2 or #3 in free-running mode and sends the raw
+ *    ADC values as binary frames with a sequence number (see README)
+ *  - 10 bit samples or 8 bit samples (fast mode)
+ *  - sample rate is set by the ADC prescaler
+ *  - requires hardware TTL serial (SERIAL_HARDWARE) and a high baud rate
+ *    (SERIAL_BAUDRATE), SERIAL_TX_BUFFER is recommended
+ *  - uncomment to enable
+ */
+
+//#define SW_ADC_STREAM
+
+
 
 /* ************************************************************************
  *   Makefile workaround for some IDEs 
@@ -433,6 +474,71 @@
 //#define UI_SERIAL_COMMANDS
 
 
+/*
+ *  Binary telemetry for remote commands.
+ *  - DATA returns the complete probing result in a single binary frame
+ *    (see README for the frame format)
+ *  - PUSH sends the frame also after each probing cycle, NOPUSH stops it
+ *  - requires UI_SERIAL_COMMANDS
+ *  - uncomment to enable
+ */
+
+//#define UI_SERIAL_TELEMETRY
+
+
+/*
+ *  Keep a copy of the text on screen and redraw only changed characters.
+ *  - speeds up continous mode, especially on slow displays
+ *  - the result of the last probing stays on screen until the new one
+ *    is displayed, changed characters are sent in runs
+ *  - SHADOW_SIZE: max. number of character cells (lines * chars per line),
+ *    needs 1 byte RAM per cell plus 2 bytes for the pen color and
+ *    2 bits for housekeeping; if the display has more cells, each screen
+ *    is cleared as without buffer (e.g. ILI9163 with 8x8 font: 256 cells,
+ *    ILI9341 with 16x26 font: 180 cells, VT100: 960 cells)
+ *  - supported by all displays
+ *  - uncomment to enable
+ */
+
+//#define UI_TEXT_SHADOW
+#define SHADOW_SIZE      160
+
+
+/*
+ *  Keep the pixel runs of recently used characters in RAM.
+ *  - speeds up character output on color displays, since the font
+ *    bitmap doesn't have to be processed again
+ *  - GLYPH_CACHE_SIZE: number of cached characters
+ *  - GLYPH_CACHE_RUNS: max. number of pixel runs per character (up to 254),
+ *    characters with more runs aren't cached
+ *    - default is based on the font and covers all characters:
+ *      8x8: 36, 10x16: 60, 8x16 cyrillic: 68, 12x16: 70, 16x26: 104
+ *    - uncomment to override default
+ *  - needs (GLYPH_CACHE_RUNS + 2) bytes RAM per character,
+ *    e.g. 228 bytes for 8x8 and 636 bytes for 16x26 with 6 characters
+ *  - supported by ILI9163, ILI9341 and ST7735
+ *  - uncomment to enable
+ */
+
+//#define UI_GLYPH_CACHE
+#define GLYPH_CACHE_SIZE 6
+//#define GLYPH_CACHE_RUNS 40
+
+
+/*
+ *  Use run-length encoded fonts and symbols (*_rle.h in bitmaps).
+ *  - saves about 35% flash for the larger fonts and about 20% for the
+ *    symbols, and sends pixel runs directly to the display
+ *  - small fonts (8x8, 8x16 cyrillic) don't compress and are kept as
+ *    they are
+ *  - headers are created by bitmaps/rle.py ("make rle")
+ *  - supported by ILI9163, ILI9341 and ST7735
+ *  - uncomment to enable
+ */
+
+//#define UI_BITMAP_RLE
+
+
 /*
  *  Maximum time to wait after probing in continous mode (in ms).
  *  - Time between printing the result and starting a new probing cycle.
@@ -682,6 +788,10 @@
  *  - hardware I2C (TWI) uses automatically the proper MCU pins
  *  - uncomment either I2C_BITBANG or I2C_HARDWARE to enable
  *  - uncomment one of the bus speed modes
+ *  - I2C_INTERRUPT runs transactions in the background (hardware TWI
+ *    only), used by SSD1306 with LCD_PAGE_SHADOW; the MCU sleeps in
+ *    idle mode then to keep the TWI running, and measurements wait
+ *    until all transfers are done
  */
 
 //#define I2C_BITBANG                /* bit-bang I2C */
@@ -689,6 +799,7 @@
 //#define I2C_STANDARD_MODE          /* 100kHz bus speed */
 //#define I2C_FAST_MODE              /* 400kHz bus speed */
 //#define I2C_RW                     /* enable I2C read support (untested) */
+//#define I2C_INTERRUPT              /* interrupt driven TWI transactions */
 
 
 /*
@@ -697,11 +808,19 @@
  *  - could already be enabled in display section (config_<MCU>.h)
  *  - for bit-bang SPI port and pins see SPI_PORT (config_<MCU>.h)
  *  - hardware SPI uses automatically the proper MCU pins
- *  - uncomment either SPI_BITBANG or SPI_HARDWARE to enable
+ *  - USART in master SPI mode uses USART0 (TxD for MOSI, RxD for MISO)
+ *    and XCK for SCK, for XCK pin see SPI_XCK (config_<MCU>.h)
+ *    can't be combined with hardware TTL serial or the frequency counter
+ *    (XCK is T0), bit-bang serial and display must use other pins
+ *  - uncomment either SPI_BITBANG, SPI_HARDWARE or SPI_USART to enable
+ *  - SPI_BITBANG_ASM speeds up bit-bang SPI by about factor 2 (clear
+ *    screen by factor 3), not for slow chips like ST7920 and ADS7843
  */
 
 //#define SPI_BITBANG                /* bit-bang SPI */
 //#define SPI_HARDWARE               /* hardware SPI */
+//#define SPI_USART                  /* USART in master SPI mode */
+//#define SPI_BITBANG_ASM            /* unrolled assembler bit-bang SPI */
 //#define SPI_RW                     /* enable SPI read support */
 
 
@@ -711,11 +830,21 @@
  *  - for bit-bang serial port and pins see SERIAL_PORT (config_<MCU>.h)
  *  - hardware serial uses automatically the proper MCU pins
  *  - uncomment either SERIAL_BITBANG or SERIAL_HARDWARE to enable
+ *  - SERIAL_TX_BUFFER sends data in the background via a 32 byte buffer
+ *    (interrupt driven), bit-bang serial uses Timer2 for that
+ *  - SERIAL_BAUDRATE: 9600 up to 250000bps (8N1)
+ *    hardware serial: baud rate error has to be within 2% for the MCU
+ *      clock, e.g. 8MHz: 9600, 19200, 38400, 76800, 250000
+ *      16MHz: 9600 - 76800, 250000
+ *    bit-bang serial: needs at least 100 MCU cycles per bit,
+ *      e.g. 8MHz: up to 57600, 16MHz: up to 115200
  */
 
 //#define SERIAL_BITBANG             /* bit-bang serial */
 //#define SERIAL_HARDWARE            /* hardware serial */
 //#define SERIAL_RW                  /* enable serial read support */
+//#define SERIAL_TX_BUFFER           /* buffered TX */
+#define SERIAL_BAUDRATE     9600     /* baud rate (bps) */
 
 
 /*
@@ -883,14 +1012,54 @@
 
 
 /* SPI */
-#if defined (SPI_BITBANG) || defined (SPI_HARDWARE)
+#if defined (SPI_BITBANG) || defined (SPI_HARDWARE) || defined (SPI_USART)
   #define HW_SPI
+
+  /* pixel data for color graphic displays */
+  #if defined (LCD_ILI9341) || defined (LCD_ST7735) || defined (LCD_ILI9163)
+    #define SPI_FILL
+    #define SPI_WORD
+  #endif
+#endif
+
+
+/* unrolled bit-bang SPI: bit-bang only and too fast for some chips */
+#ifdef SPI_BITBANG_ASM
+  #if ! defined (SPI_BITBANG) || defined (LCD_ST7920) || defined (TOUCH_PORT)
+    #undef SPI_BITBANG_ASM
+  #endif
+#endif
+
+
+/* USART0 can't be used for SPI and TTL serial at the same time */
+#if defined (SPI_USART) && defined (SERIAL_HARDWARE)
+  #if SERIAL_USART == 0
+    #error <<< USART0 used for SPI and TTL serial! >>>
+  #endif
+#endif
+
+
+/* interrupt driven transactions require hardware TWI */
+#if defined (I2C_INTERRUPT) && ! defined (I2C_HARDWARE)
+  #undef I2C_INTERRUPT
 #endif
 
 
 /* I2C */
 #if defined (I2C_BITBANG) || defined (I2C_HARDWARE)
   #define HW_I2C
+
+  /* PCF8574 gets both nibbles in a single transfer */
+  #ifdef LCD_PCF8574
+    #define I2C_BLOCK
+  #endif
+
+  /* page shadow sends blocks of data to SSD1306 */
+  #if defined (LCD_SSD1306) && defined (LCD_I2C) && defined (LCD_PAGE_SHADOW)
+    #ifndef I2C_INTERRUPT
+      #define I2C_BLOCK
+    #endif
+  #endif
 #endif
 
 
@@ -899,6 +1068,40 @@
   #define HW_SERIAL
 #endif
 
+/* buffered TX requires TTL serial */
+#if defined (SERIAL_TX_BUFFER) && ! defined (HW_SERIAL)
+  #undef SERIAL_TX_BUFFER
+#endif
+
+/* baud rate of TTL serial */
+#ifdef HW_SERIAL
+  #if (SERIAL_BAUDRATE < 9600) || (SERIAL_BAUDRATE > 250000)
+    #error <<< SERIAL_BAUDRATE: 9600 - 250000! >>>
+  #endif
+
+  /* MCU cycles per bit (rounded) */
+  #define SERIAL_BIT_CYCLES   ((CPU_FREQ + SERIAL_BAUDRATE / 2) / SERIAL_BAUDRATE)
+
+  #ifdef SERIAL_HARDWARE
+    /* UBRR for double speed mode (U2X), rounded */
+    #define SERIAL_UBRR    (((CPU_FREQ + 4UL * SERIAL_BAUDRATE) / (8UL * SERIAL_BAUDRATE)) - 1)
+    /* real baud rate */
+    #define SERIAL_REAL    (CPU_FREQ / (8UL * (SERIAL_UBRR + 1)))
+
+    /* baud rate error > 2% */
+    #if (SERIAL_REAL * 50 > SERIAL_BAUDRATE * 51) || (SERIAL_REAL * 50 < SERIAL_BAUDRATE * 49)
+      #error <<< SERIAL_BAUDRATE: too large error for this MCU clock! >>>
+    #endif
+  #endif
+
+  #ifdef SERIAL_BITBANG
+    /* bit loop and ISRs need some time */
+    #if SERIAL_BIT_CYCLES < 100
+      #error <<< SERIAL_BAUDRATE: too high for bit-bang serial! >>>
+    #endif
+  #endif
+#endif
+
 /* VT100 display driver disables other options for serial interface */
 #ifdef LCD_VT100
   #ifdef UI_SERIAL_COPY
@@ -929,6 +1132,20 @@
   #endif
 #endif
 
+/* options which require remote commands */
+#ifndef UI_SERIAL_COMMANDS
+  #ifdef UI_SERIAL_TELEMETRY
+    #undef UI_SERIAL_TELEMETRY
+  #endif
+#endif
+
+/* options which require hardware TTL serial (not used by VT100) */
+#if ! defined (SERIAL_HARDWARE) || defined (LCD_VT100)
+  #ifdef SW_ADC_STREAM
+    #undef SW_ADC_STREAM
+  #endif
+#endif
+
 
 /* OneWire: probe leads prevail */
 #ifdef ONEWIRE_PROBES
@@ -960,6 +1177,61 @@
 #endif
 
 
+/* HD44780: busy flag requires R/W line (4 bit parallel) */
+#if defined (LCD_HD44780) && defined (LCD_PAR_4) && defined (LCD_RW)
+  #define LCD_BUSY_FLAG
+  #ifndef LCD_PIN
+    #error <<< LCD_RW requires LCD_PIN! >>>
+  #endif
+#endif
+
+
+/* page shadow requires a page based display and enough RAM */
+#ifdef LCD_PAGE_SHADOW
+  #if ! defined (LCD_PCD8544) && ! defined (LCD_ST7565R) && ! defined (LCD_SSD1306)
+    #undef LCD_PAGE_SHADOW
+  #elif (RES_RAM < 4) && (LCD_DOTS_X * LCD_DOTS_Y / 8 > 512)
+    #error <<< Not enough RAM for LCD_PAGE_SHADOW! >>>
+  #endif
+#endif
+
+
+/* GDRAM shadow requires ST7920 and enough RAM */
+#ifdef LCD_GDRAM_SHADOW
+  #ifndef LCD_ST7920
+    #undef LCD_GDRAM_SHADOW
+  #elif RES_RAM < 4
+    #error <<< Not enough RAM for LCD_GDRAM_SHADOW! >>>
+  #endif
+#endif
+
+
+/* glyph cache requires a supported display */
+#ifdef UI_GLYPH_CACHE
+  #if ! defined (LCD_ILI9341) && ! defined (LCD_ST7735) && ! defined (LCD_ILI9163)
+    #undef UI_GLYPH_CACHE
+  #endif
+#endif
+
+
+/* glyph cache: max. number of runs based on font */
+#ifdef UI_GLYPH_CACHE
+  #ifndef GLYPH_CACHE_RUNS
+    #if defined (FONT_16X26_HF)
+      #define GLYPH_CACHE_RUNS    104
+    #elif defined (FONT_12X16_HF)
+      #define GLYPH_CACHE_RUNS    70
+    #elif defined (FONT_8X16_CYRILLIC_HF)
+      #define GLYPH_CACHE_RUNS    68
+    #elif defined (FONT_10X16_HF)
+      #define GLYPH_CACHE_RUNS    60
+    #else
+      #define GLYPH_CACHE_RUNS    36
+    #endif
+  #endif
+#endif
+
+
 /* color coding for probes requires a color graphics display */
 #ifdef SW_PROBE_COLORS
   #ifndef LCD_COLOR
@@ -996,6 +1268,13 @@
 #endif
 
 
+/* USART0 in master SPI mode: T0 input of frequency counter is XCK */
+/* other pins are checked in SPI.c */
+#if defined (SPI_USART) && defined (HW_FREQ_COUNTER)
+  #error <<< SPI_USART: XCK used by frequency counter! >>>
+#endif
+
+
 /* IR detector/decoder: probe lead based decoder prevails */
 #ifdef SW_IR_RECEIVER
   #undef HW_IR_RECEIVER
@@ -32,6 +32,8 @@
 /*
  *  HD44780, 4 bit parallel interface
  *  - if you change LCD_DB4/5/6/7 comment out LCD_DB_STD!
+ *  - for reading the busy flag connect R/W to a free pin of LCD_PORT
+ *    and set LCD_RW
  */
 
 #if 0
@@ -40,6 +42,7 @@
 #define LCD_PAR_4                       /* 4 bit parallel interface */
 #define LCD_PORT         PORTD          /* port data register */
 #define LCD_DDR          DDRD           /* port data direction register */
+#define LCD_PIN          PIND           /* port input pins register */
 #define LCD_DB_STD                      /* use standard pins 0-3 for DB4-7 */
 #define LCD_DB4          PD0            /* port pin used for DB4 */
 #define LCD_DB5          PD1            /* port pin used for DB5 */
@@ -216,6 +219,7 @@
 #define LCD_DOTS_X       84             /* number of horizontal dots */
 #define LCD_DOTS_Y       48             /* number of vertical dots */
 #define LCD_CONTRAST     66             /* default contrast (1-127) */
+//#define LCD_PAGE_SHADOW                 /* send only changes, needs 504 bytes RAM */
 #define FONT_6X8_VF                     /* 6x8 font, vertically aligned & flipped */
 #define SYMBOLS_24X24_VFP               /* 24x24 symbols, vertically aligned & flipped */
 //#define LCD_ROT180                      /* rotate output by 180� (not supported yet) */
@@ -523,6 +527,7 @@
 /*
  *  SPI
  *  - hardware SPI uses PB5, PB3 and PB4
+ *  - USART0 in master SPI mode uses PD4 (XCK), PD1 (TxD) and PD0 (RxD)
  *  - could be already set in display section
  */
 
@@ -536,6 +541,12 @@
 #define SPI_MISO         PB4       /* pin for MISO */
 #endif
 
+/* for USART in master SPI mode */
+#define SPI_XCK_DDR      DDRD      /* port data direction register */
+#define SPI_XCK          PD4       /* pin for XCK (SCK) */
+#define SPI_TXD          PD1       /* pin for TxD (MOSI), fixed */
+#define SPI_RXD          PD0       /* pin for RxD (MISO), fixed */
+
 
 /*
  *  I2C
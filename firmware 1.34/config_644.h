@@ -40,6 +40,7 @@
 #define LCD_PAR_4                       /* 4 bit parallel interface */
 #define LCD_PORT         PORTB          /* port data register */
 #define LCD_DDR          DDRB           /* port data direction register */
+#define LCD_PIN          PINB           /* port input pins register */
 //#define LCD_DB_STD                      /* use standard pins 0-3 for DB4-7 */
 #define LCD_DB4          PB4            /* port pin used for DB4 */
 #define LCD_DB5          PB5            /* port pin used for DB5 */
@@ -47,6 +48,7 @@
 #define LCD_DB7          PB7            /* port pin used for DB7 */
 #define LCD_RS           PB2            /* port pin used for RS */
 #define LCD_EN1          PB3            /* port pin used for E */
+//#define LCD_RW           PB1            /* port pin used for R/W (optional, busy flag) */
 #define LCD_CHAR_X       16             /* characters per line */
 #define LCD_CHAR_Y       2              /* number of lines */
 #define FONT_HD44780_INT                /* internal 5x7 font: international */
@@ -109,6 +111,7 @@
 #define LCD_FLIP_Y                      /* enable vertical flip */
 #define LCD_START_Y      0              /* start line (0-63) */
 #define LCD_CONTRAST     22             /* default contrast (0-63) */
+//#define LCD_PAGE_SHADOW                 /* send only changes, needs 1kB RAM */
 #define FONT_8X8_VF                     /* 8x8 font, vertically aligned & flipped */
 #define SYMBOLS_24X24_VFP               /* 24x24 symbols, vertically aligned & flipped */
 #define SPI_HARDWARE                    /* hardware SPI */
@@ -198,6 +201,7 @@
 #define LCD_DOTS_X       84             /* number of horizontal dots */
 #define LCD_DOTS_Y       48             /* number of vertical dots */
 #define LCD_CONTRAST     66             /* default contrast (1-127) */
+//#define LCD_PAGE_SHADOW                 /* send only changes, needs 504 bytes RAM */
 #define FONT_6X8_VF                     /* 6x8 font, vertically aligned & flipped */
 //#define LCD_ROT180                      /* rotate output by 180 (not supported yet) */
 //#define FONT_6X8_V_F                    /* 6x8 font, vertically aligned, hor. flipped */
@@ -231,6 +235,7 @@
 //#define LCD_ROT180                      /* rotate output by 180 */
 //#define FONT_8X8_HF                     /* 8x8 font, horizonally aligned & flipped */
 //#define SYMBOLS_24X24_HF                /* 24x24 symbols, horizonally aligned & flipped */
+//#define LCD_GDRAM_SHADOW                /* send only changes, needs 1.1kB RAM */
 #define SPI_HARDWARE                    /* hardware SPI */
 #endif
 
@@ -264,6 +269,7 @@
 //#define LCD_ROT180                      /* rotate output by 180 */
 //#define FONT_8X8_HF                     /* 8x8 font, horizonally aligned & flipped */
 //#define SYMBOLS_24X24_HF                /* 24x24 symbols, horizonally aligned & flipped */
+//#define LCD_GDRAM_SHADOW                /* send only changes, needs 1.1kB RAM */
 #endif
 
 
@@ -320,6 +326,7 @@
 #define LCD_FLIP_X                      /* enable horizontal flip */
 #define LCD_FLIP_Y                      /* enable vertical flip */
 #define LCD_CONTRAST     127            /* default contrast (0-255) */
+//#define LCD_PAGE_SHADOW                 /* send only changes, needs 1kB RAM */
 #define FONT_8X8_VF                     /* 8x8 font, vertically aligned & flipped */
 #define SYMBOLS_24X24_VFP               /* 24x24 symbols, vertically aligned & flipped */
 #define SPI_HARDWARE                    /* hardware SPI */
@@ -344,6 +351,7 @@
 #define LCD_FLIP_X                      /* enable horizontal flip */
 #define LCD_FLIP_Y                      /* enable vertical flip */
 #define LCD_CONTRAST     127            /* default contrast (0-255) */
+//#define LCD_PAGE_SHADOW                 /* send only changes, needs 1kB RAM */
 #define FONT_8X8_VF                     /* 8x8 font, vertically aligned & flipped */
 #define SYMBOLS_24X24_VFP               /* 24x24 symbols, vertically aligned & flipped */
 #define I2C_HARDWARE                    /* hardware I2C (MCU's TWI) */
@@ -530,6 +538,7 @@
 /*
  *  SPI
  *  - hardware SPI uses PB7, PB5 and PB6
+ *  - USART0 in master SPI mode uses PB0 (XCK), PD1 (TxD) and PD0 (RxD)
  *  - could be already set in display section
  */
 
@@ -543,6 +552,12 @@
 #define SPI_MISO         PB6       /* pin for MISO */
 #endif
 
+/* for USART in master SPI mode */
+#define SPI_XCK_DDR      DDRB      /* port data direction register */
+#define SPI_XCK          PB0       /* pin for XCK (SCK) */
+#define SPI_TXD          PD1       /* pin for TxD (MOSI), fixed */
+#define SPI_RXD          PD0       /* pin for RxD (MISO), fixed */
+
 
 /*
  *  I2C
@@ -14,6 +14,10 @@
 /* source management */
 #define DISPLAY_C
 
+/* screen buffer modes */
+#define SHADOW_SCREEN         0b00000001     /* building new screen */
+#define SHADOW_SENDING        0b00000010     /* sending changes */
+
 
 /*
  *  include header files
@@ -26,6 +30,59 @@
 #include "functions.h"        /* external functions */
 
 
+/*
+ *  derived constants
+ */
+
+#ifdef LCD_PAGE_SHADOW
+  /* size of page shadow */
+  #define PAGE_NUMBER       (LCD_DOTS_Y / 8)  /* pages */
+  #ifdef LCD_ST7565R
+    #define PAGE_COLUMNS    132               /* controller RAM is wider */
+  #else
+    #define PAGE_COLUMNS    LCD_DOTS_X        /* columns */
+  #endif
+#endif
+
+
+
+/*
+ *  local variables
+ */
+
+#ifdef UI_TEXT_SHADOW
+/* screen buffer: characters on screen */
+unsigned char       ShadowText[SHADOW_SIZE];     /* 0 = unknown */
+uint8_t             ShadowUsed[(SHADOW_SIZE + 7) / 8];   /* written cells */
+uint8_t             ShadowDirty[(SHADOW_SIZE + 7) / 8];  /* cells to send */
+#ifdef LCD_COLOR
+uint16_t            ShadowColor[SHADOW_SIZE];    /* pen colors */
+#endif
+uint8_t             ShadowMode = 0;              /* buffer mode */
+uint8_t             ShadowSync = 0;              /* driver needs re-sync */
+#endif
+
+#ifdef UI_GLYPH_CACHE
+/* glyph cache: pixel runs of recently used characters */
+unsigned char       GlyphChar[GLYPH_CACHE_SIZE];           /* characters */
+uint8_t             GlyphRuns[GLYPH_CACHE_SIZE][GLYPH_CACHE_RUNS + 1];
+uint8_t             GlyphNext = 0;               /* next entry to replace */
+#ifdef LCD_COLOR
+uint16_t            GlyphColor = 0;              /* pen color of entries */
+#endif
+#endif
+
+#ifdef LCD_PAGE_SHADOW
+/* page shadow: copy of display RAM */
+uint8_t             PageBuffer[PAGE_NUMBER][PAGE_COLUMNS];
+uint8_t             PageFirst[PAGE_NUMBER];      /* first dirty column */
+uint8_t             PageLast[PAGE_NUMBER];       /* last dirty column */
+uint8_t             PageX = 0;                   /* write position: column */
+uint8_t             PageY = 0;                   /* write position: page */
+uint8_t             PageMode = 0;                /* 1 = sending */
+#endif
+
+
 
 /* ************************************************************************
  *   display of characters and strings
@@ -354,6 +411,772 @@ void Display_EEString_NL(const unsigned char *String)
 
 
 
+/* ************************************************************************
+ *   screen buffer (text layer shadow)
+ * ************************************************************************ */
+
+
+#ifdef UI_TEXT_SHADOW
+
+/*
+ *  The screen buffer keeps a copy of the characters on screen (plus their
+ *  pen color). All display drivers ask the buffer before drawing a
+ *  character and skip it when the same character is shown already.
+ *
+ *  Shadow_Clear() starts a new screen without clearing the display. While
+ *  the new screen is built, changed characters are only marked as dirty.
+ *  Shadow_Flush() sends them later in one go, sorted by position, so a run
+ *  of neighboring characters needs only one LCD_CharPos(). Cells which
+ *  weren't written again are cleared when the screen is finished. This
+ *  happens automatically when waiting for the user (TestKey()). Any code
+ *  which waits otherwise has to call Shadow_Flush() before. Only main()
+ *  uses Shadow_Clear(), LCD_Clear() ends building a screen.
+ */
+
+
+/*
+ *  get buffer index of a character cell
+ *
+ *  requires:
+ *  - x: horizontal position (1-)
+ *  - y: vertical position (1-)
+ *
+ *  returns:
+ *  - index
+ *  - SHADOW_SIZE if not covered by buffer
+ */
+
+uint16_t Shadow_Index(uint8_t x, uint8_t y)
+{
+  uint16_t          Index = SHADOW_SIZE;     /* return value */
+
+  if ((x >= 1) && (x <= UI.CharMax_X) && (y >= 1) && (y <= UI.CharMax_Y))
+  {
+    Index = y - 1;
+    Index *= UI.CharMax_X;
+    Index += x - 1;
+    if (Index >= SHADOW_SIZE) Index = SHADOW_SIZE;
+  }
+
+  return Index;
+}
+
+
+
+/*
+ *  check character against buffer and update buffer
+ *  - called by display driver for the current character position
+ *  - re-syncs driver's RAM address after skipped characters
+ *
+ *  requires:
+ *  - Char: character to display
+ *
+ *  returns:
+ *  - 1 if character is on screen already or delayed (skip it)
+ *  - 0 if character has to be drawn now
+ */
+
+uint8_t Shadow_Check(unsigned char Char)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint8_t           Same = 0;           /* same character on screen */
+  uint8_t           Mask;               /* bit mask */
+  uint16_t          Index;              /* cell index */
+
+  if (ShadowMode & SHADOW_SENDING)      /* sent by Shadow_Flush() */
+  {
+    return Flag;                        /* draw it */
+  }
+
+  Index = Shadow_Index(UI.CharPos_X, UI.CharPos_Y);
+  if (Index < SHADOW_SIZE)              /* cell is covered */
+  {
+    Mask = 1 << (Index % 8);
+    ShadowUsed[Index / 8] |= Mask;      /* mark as written */
+
+    if (ShadowText[Index] == Char)      /* same character */
+    {
+      Same = 1;
+
+      #ifdef LCD_COLOR
+      if ((Char != ' ') && (ShadowColor[Index] != UI.PenColor))
+      {
+        Same = 0;                       /* color differs */
+      }
+      #endif
+    }
+
+    /* update buffer */
+    ShadowText[Index] = Char;
+    #ifdef LCD_COLOR
+    ShadowColor[Index] = UI.PenColor;
+    #endif
+
+    if (ShadowMode & SHADOW_SCREEN)     /* building new screen */
+    {
+      /* delay output until Shadow_Flush() */
+      if (! Same) ShadowDirty[Index / 8] |= Mask;
+      Flag = 1;                         /* skip */
+    }
+    else if (Same && ! (ShadowDirty[Index / 8] & Mask))
+    {
+      Flag = 1;                         /* on screen already */
+    }
+    else
+    {
+      ShadowDirty[Index / 8] &= ~Mask;  /* will be drawn now */
+    }
+  }
+
+  if (Flag)                        /* skipped */
+  {
+    ShadowSync = 1;                /* driver's RAM address is behind */
+  }
+  else if (ShadowSync)             /* draw after skipped chars */
+  {
+    ShadowSync = 0;
+    LCD_CharPos(UI.CharPos_X, UI.CharPos_Y);      /* re-sync driver */
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  update buffer for clearing a line
+ *  - called by display driver
+ *
+ *  requires:
+ *  - Line: line number (1-)
+ *  - Pos: first character position (1-)
+ *
+ *  returns:
+ *  - 1 if line has to be cleared
+ *  - 0 if line is blank already
+ */
+
+uint8_t Shadow_ClearLine(uint8_t Line, uint8_t Pos)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint8_t           Mask;               /* bit mask */
+  uint16_t          Index;              /* cell index */
+
+  if (Line > UI.CharMax_Y)              /* partial line at bottom */
+  {
+    return 1;                           /* not covered by buffer */
+  }
+
+  while (Pos <= UI.CharMax_X)
+  {
+    Index = Shadow_Index(Pos, Line);
+    if (Index >= SHADOW_SIZE)           /* not covered */
+    {
+      Flag = 1;                         /* clear anyway */
+      break;
+    }
+
+    Mask = 1 << (Index % 8);
+    if ((ShadowText[Index] != ' ') || (ShadowDirty[Index / 8] & Mask))
+    {
+      /* display shows something */
+      ShadowText[Index] = ' ';          /* will be blank */
+      ShadowDirty[Index / 8] &= ~Mask;
+      Flag = 1;
+    }
+
+    Pos++;                              /* next cell */
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  get character on screen
+ *  - called by display driver, e.g. to redraw a few cells instead of
+ *    moving the cursor
+ *
+ *  requires:
+ *  - x: horizontal position (1-)
+ *  - y: vertical position (1-)
+ *  - Color: pen color the cell would be drawn with
+ *    (ignored for monochrome displays)
+ *
+ *  returns:
+ *  - character
+ *  - 0 if unknown, not sent yet or shown in another color
+ */
+
+unsigned char Shadow_Char(uint8_t x, uint8_t y, uint16_t Color)
+{
+  unsigned char     Char = 0;           /* return value */
+  uint16_t          Index;              /* cell index */
+
+  Index = Shadow_Index(x, y);
+  if (Index < SHADOW_SIZE)              /* cell is covered */
+  {
+    if (! (ShadowDirty[Index / 8] & (1 << (Index % 8))))
+    {
+      Char = ShadowText[Index];         /* on screen */
+
+      #ifdef LCD_COLOR
+      if ((Char != ' ') && (ShadowColor[Index] != Color))
+      {
+        Char = 0;                       /* color differs */
+      }
+      #endif
+    }
+  }
+
+  return Char;
+}
+
+
+
+/*
+ *  update buffer after clearing the display
+ *  - called by display driver
+ *  - a cleared display starts a screen which is drawn directly, so
+ *    screens of menus and tools don't have to call Shadow_Flush()
+ */
+
+void Shadow_Blank(void)
+{
+  uint16_t          Index = 0;          /* cell index */
+
+  ShadowMode = 0;                       /* end building screen */
+
+  while (Index < SHADOW_SIZE)
+  {
+    ShadowText[Index] = ' ';            /* blank */
+    ShadowDirty[Index / 8] = 0;         /* nothing to send */
+    Index++;
+  }
+}
+
+
+
+/*
+ *  mark cells as unknown, e.g. after drawing a symbol
+ *  - called by display driver
+ *  - starts at current character position
+ *
+ *  requires:
+ *  - Width: number of cells in x direction
+ *  - Height: number of cells in y direction
+ */
+
+void Shadow_Invalidate(uint8_t Width, uint8_t Height)
+{
+  uint8_t           x, y;               /* cell position */
+  uint8_t           Mask;               /* bit mask */
+  uint16_t          Index;              /* cell index */
+
+  y = UI.CharPos_Y;
+  while (Height > 0)
+  {
+    x = 0;
+    while (x < Width)
+    {
+      Index = Shadow_Index(UI.CharPos_X + x, y);
+      if (Index < SHADOW_SIZE)
+      {
+        Mask = 1 << (Index % 8);
+        ShadowText[Index] = 0;          /* unknown */
+        ShadowUsed[Index / 8] |= Mask;  /* mark as written */
+        ShadowDirty[Index / 8] &= ~Mask;     /* symbol is drawn already */
+      }
+      x++;
+    }
+
+    y++;
+    Height--;
+  }
+}
+
+
+
+/*
+ *  start new screen
+ *  - replacement for LCD_Clear() when the next screen is likely to
+ *    look similar to the current one
+ *  - keeps display content, changes are sent by Shadow_Flush()
+ *  - clears display if the buffer doesn't cover the whole screen,
+ *    since uncovered cells would never be cleared
+ */
+
+void Shadow_Clear(void)
+{
+  uint8_t           n = 0;              /* counter */
+  uint16_t          Cells;              /* cells on screen */
+
+  /* check if buffer covers screen */
+  Cells = UI.CharMax_X;
+  Cells *= UI.CharMax_Y;
+  if (Cells > SHADOW_SIZE)         /* screen too large */
+  {
+    ShadowMode = 0;                /* draw directly */
+    LCD_Clear();                   /* clear display */
+    return;
+  }
+
+  /* no cells written yet */
+  while (n < sizeof(ShadowUsed))
+  {
+    ShadowUsed[n] = 0;
+    n++;
+  }
+
+  ShadowMode = SHADOW_SCREEN;      /* building new screen */
+  LCD_CharPos(1, 1);               /* reset character position */
+}
+
+
+
+#ifdef LCD_VT100
+
+/*
+ *  check if rest of line will be blank
+ *  - used by Shadow_Flush()
+ *
+ *  requires:
+ *  - x: horizontal position (1-)
+ *  - y: vertical position (1-)
+ *  - Mode: mode of Shadow_Flush()
+ *
+ *  returns:
+ *  - 1 if blank
+ *  - 0 if not
+ */
+
+uint8_t Shadow_BlankTail(uint8_t x, uint8_t y, uint8_t Mode)
+{
+  uint8_t           Mask;               /* bit mask */
+  uint16_t          Index;              /* cell index */
+
+  while (x <= UI.CharMax_X)
+  {
+    Index = Shadow_Index(x, y);
+    if (Index >= SHADOW_SIZE) return 0; /* not covered */
+    Mask = 1 << (Index % 8);
+
+    if (ShadowText[Index] != ' ')       /* not blank */
+    {
+      /* old cell not overwritten will be cleared */
+      if ((Mode != SHADOW_DONE) || (ShadowUsed[Index / 8] & Mask))
+      {
+        return 0;
+      }
+    }
+
+    x++;                                /* next cell */
+  }
+
+  return 1;
+}
+
+#endif
+
+
+
+/*
+ *  send changed characters to display
+ *  - runs of neighboring cells are sent with a single LCD_CharPos()
+ *
+ *  requires:
+ *  - Mode:
+ *    SHADOW_UPDATE  send changes, keep building the screen
+ *    SHADOW_DONE    also clear cells not written since Shadow_Clear()
+ *                   and finish the screen
+ */
+
+void Shadow_Flush(uint8_t Mode)
+{
+  uint8_t           x, y;               /* cell position */
+  uint8_t           Run;                /* run of dirty cells */
+  uint8_t           Mask;               /* bit mask */
+  uint8_t           Old_X, Old_Y;       /* old character position */
+  uint16_t          Index;              /* cell index */
+  #ifdef LCD_COLOR
+  uint16_t          Color;              /* old pen color */
+  #endif
+
+  if (! (ShadowMode & SHADOW_SCREEN)) return;    /* nothing to do */
+  ShadowMode |= SHADOW_SENDING;         /* bypass buffer */
+
+  /* save character position and pen color */
+  Old_X = UI.CharPos_X;
+  Old_Y = UI.CharPos_Y;
+  #ifdef LCD_COLOR
+  Color = UI.PenColor;
+  #endif
+
+  y = 1;
+  while (y <= UI.CharMax_Y)
+  {
+    x = 1;
+    Run = 0;
+    while (x <= UI.CharMax_X)
+    {
+      Index = Shadow_Index(x, y);
+      if (Index >= SHADOW_SIZE) break;  /* not covered */
+      Mask = 1 << (Index % 8);
+
+      /* old cell not overwritten */
+      if ((Mode == SHADOW_DONE) &&
+          (! (ShadowUsed[Index / 8] & Mask)) &&
+          (ShadowText[Index] != ' '))
+      {
+        ShadowText[Index] = ' ';        /* clear cell */
+        ShadowDirty[Index / 8] |= Mask;
+      }
+
+      if (ShadowDirty[Index / 8] & Mask)     /* changed cell */
+      {
+        #ifdef LCD_VT100
+        /* terminal clears rest of line with a single sequence */
+        if (Shadow_BlankTail(x, y, Mode))
+        {
+          LCD_CharPos(x, y);
+          LCD_ClearLine(0);             /* also updates buffer */
+          break;                        /* next line */
+        }
+        #endif
+
+        if (Run == 0)                   /* start of run */
+        {
+          LCD_CharPos(x, y);
+          Run = 1;
+        }
+
+        ShadowDirty[Index / 8] &= ~Mask;
+        #ifdef LCD_COLOR
+        UI.PenColor = ShadowColor[Index];
+        #endif
+        LCD_Char(ShadowText[Index]);
+      }
+      else                              /* unchanged cell */
+      {
+        Run = 0;                        /* end of run */
+      }
+
+      x++;
+    }
+
+    y++;
+  }
+
+  /* restore character position and pen color */
+  #ifdef LCD_COLOR
+  UI.PenColor = Color;
+  #endif
+  LCD_CharPos(Old_X, Old_Y);
+  ShadowSync = 0;                  /* driver is in sync again */
+
+  if (Mode == SHADOW_DONE)         /* screen finished */
+  {
+    ShadowMode = 0;
+  }
+  else                             /* keep building */
+  {
+    ShadowMode = SHADOW_SCREEN;
+  }
+}
+
+#endif
+
+
+
+
+/* ************************************************************************
+ *   glyph cache
+ * ************************************************************************ */
+
+
+#ifdef UI_GLYPH_CACHE
+
+/*
+ *  The glyph cache keeps the pixel runs of the last few characters, so
+ *  a color display driver doesn't have to walk through the font bitmap
+ *  again. Runs alternate between background and pen color, starting with
+ *  the background color. Each entry starts with the number of runs,
+ *  0 for an empty entry and 0xff for a character with too many runs.
+ *  Since the runs are made for the current pen color, all entries are
+ *  dropped when the pen color changes.
+ */
+
+
+/*
+ *  look up character in glyph cache
+ *
+ *  requires:
+ *  - Char: character
+ *
+ *  returns:
+ *  - pointer to run list
+ *  - NULL if character isn't cached
+ */
+
+uint8_t *Glyph_Find(unsigned char Char)
+{
+  uint8_t           n = 0;         /* counter */
+  uint8_t           *Runs;         /* pointer to run list */
+
+  #ifdef LCD_COLOR
+  /* runs are made for a specific pen color */
+  if (UI.PenColor != GlyphColor)   /* pen color has changed */
+  {
+    while (n < GLYPH_CACHE_SIZE)   /* drop all entries */
+    {
+      GlyphRuns[n][0] = 0;
+      n++;
+    }
+
+    GlyphColor = UI.PenColor;      /* save new color */
+    return NULL;
+  }
+  #endif
+
+  while (n < GLYPH_CACHE_SIZE)     /* loop through entries */
+  {
+    Runs = &GlyphRuns[n][0];       /* run list of entry */
+
+    if ((GlyphChar[n] == Char) &&       /* character matches */
+        (*Runs > 0) && (*Runs <= GLYPH_CACHE_RUNS))    /* valid */
+    {
+      return Runs;                 /* cache hit */
+    }
+
+    n++;                           /* next entry */
+  }
+
+  return NULL;                     /* not cached */
+}
+
+
+
+/*
+ *  start new entry in glyph cache
+ *  - replaces the oldest entry
+ *
+ *  requires:
+ *  - Char: character
+ *
+ *  returns:
+ *  - pointer to empty run list
+ */
+
+uint8_t *Glyph_Add(unsigned char Char)
+{
+  uint8_t           n;             /* entry */
+  uint8_t           *Runs;         /* pointer to run list */
+
+  n = GlyphNext;                   /* get entry */
+  GlyphChar[n] = Char;             /* set character */
+  Runs = &GlyphRuns[n][0];         /* run list */
+  *Runs = 0;                       /* no runs yet */
+
+  n++;                             /* next entry */
+  if (n >= GLYPH_CACHE_SIZE) n = 0;     /* wrap around */
+  GlyphNext = n;
+
+  return Runs;
+}
+
+
+
+/*
+ *  add pixel run to glyph cache entry
+ *  - runs longer than 255 pixels are split using a zero-length run
+ *    of the other color
+ *
+ *  requires:
+ *  - Runs: pointer to run list
+ *  - Length: number of pixels
+ */
+
+void Glyph_Run(uint8_t *Runs, uint16_t Length)
+{
+  uint8_t           Count;         /* number of runs */
+  uint8_t           Part;          /* part of run */
+
+  Count = *Runs;                   /* get number of runs */
+
+  while (Count <= GLYPH_CACHE_RUNS)     /* valid entry */
+  {
+    if (Length > 255) Part = 255;       /* long run */
+    else Part = (uint8_t)Length;
+    Length -= Part;
+
+    Count++;                            /* one more run */
+    if (Count > GLYPH_CACHE_RUNS) break;     /* too many runs */
+    Runs[Count] = Part;                 /* save run */
+
+    if (Length == 0) break;             /* run done */
+
+    /* split long run by a zero-length run of the other color */
+    Count++;                            /* one more run */
+    if (Count > GLYPH_CACHE_RUNS) break;     /* too many runs */
+    Runs[Count] = 0;                    /* save run */
+  }
+
+  if (Count > GLYPH_CACHE_RUNS)    /* too many runs */
+  {
+    Count = 0xff;                  /* mark entry as invalid */
+  }
+
+  *Runs = Count;                   /* update number of runs */
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   page shadow
+ * ************************************************************************ */
+
+
+#ifdef LCD_PAGE_SHADOW
+
+/*
+ *  The page shadow is a RAM copy of the display's pages for page based
+ *  monochrome displays (PCD8544, SSD1306 and ST7565R). The driver's
+ *  LCD_DotPos() and LCD_Data() write to the shadow instead of the display,
+ *  and only bytes which actually change extend the page's dirty column
+ *  range. Page_Flush() sends the dirty ranges, one LCD_DotPos() and one
+ *  block of data per page. The drivers call it at the end of each output
+ *  function, so the display is always up to date.
+ */
+
+
+/*
+ *  mark all pages as dirty
+ *  - display content is unknown after reset
+ */
+
+void Page_Reset(void)
+{
+  uint8_t           n = 0;         /* counter */
+
+  while (n < PAGE_NUMBER)          /* for all pages */
+  {
+    PageFirst[n] = 0;              /* first column */
+    PageLast[n] = PAGE_COLUMNS - 1;     /* last column */
+    n++;                           /* next page */
+  }
+}
+
+
+
+/*
+ *  set write position
+ *
+ *  requires:
+ *  - x: column (0-)
+ *  - y: page (0-)
+ *
+ *  returns:
+ *  - 1 if buffered
+ *  - 0 if sending (driver has to set position)
+ */
+
+uint8_t Page_Pos(uint8_t x, uint8_t y)
+{
+  if (PageMode) return 0;          /* sent by Page_Flush() */
+
+  PageX = x;
+  PageY = y;
+
+  return 1;
+}
+
+
+
+/*
+ *  write byte to page shadow
+ *  - moves to next column, and to next page at the end of a page
+ *    (like horizontal addressing)
+ *
+ *  requires:
+ *  - Byte: data byte
+ *
+ *  returns:
+ *  - 1 if buffered
+ *  - 0 if sending (driver has to send byte)
+ */
+
+uint8_t Page_Data(uint8_t Byte)
+{
+  uint8_t           *Data;         /* pointer to shadow */
+
+  if (PageMode) return 0;          /* sent by Page_Flush() */
+
+  if ((PageX < PAGE_COLUMNS) && (PageY < PAGE_NUMBER))
+  {
+    Data = &PageBuffer[PageY][PageX];
+
+    if (*Data != Byte)             /* byte changes */
+    {
+      *Data = Byte;                /* update shadow */
+
+      /* extend dirty range */
+      if (PageX < PageFirst[PageY]) PageFirst[PageY] = PageX;
+      if (PageX > PageLast[PageY]) PageLast[PageY] = PageX;
+    }
+  }
+
+  PageX++;                         /* next column */
+  if (PageX >= PAGE_COLUMNS)       /* end of page */
+  {
+    PageX = 0;                     /* first column */
+    PageY++;                       /* of next page */
+    if (PageY >= PAGE_NUMBER) PageY = 0;     /* wrap around */
+  }
+
+  return 1;
+}
+
+
+
+/*
+ *  send dirty ranges of all pages to the display
+ */
+
+void Page_Flush(void)
+{
+  uint8_t           Page = 0;      /* page counter */
+  uint8_t           First;         /* first dirty column */
+
+  PageMode = 1;                    /* bypass shadow */
+
+  while (Page < PAGE_NUMBER)       /* for all pages */
+  {
+    First = PageFirst[Page];
+
+    if (First <= PageLast[Page])   /* page is dirty */
+    {
+      LCD_DotPos(First, Page);     /* set start position */
+      LCD_DataBlock(&PageBuffer[Page][First], PageLast[Page] - First + 1);
+
+      /* page is clean */
+      PageFirst[Page] = 0xff;
+      PageLast[Page] = 0;
+    }
+
+    Page++;                        /* next page */
+  }
+
+  PageMode = 0;                    /* back to shadow */
+}
+
+#endif
+
+
+
+
 /* ************************************************************************
  *   display of values and units
  * ************************************************************************ */
@@ -833,6 +1656,10 @@ void LCD_FancySemiPinout(uint8_t Line)
  *   clean-up of local constants
  * ************************************************************************ */
 
+/* screen buffer modes */
+#undef SHADOW_SCREEN
+#undef SHADOW_SENDING
+
 /* source management */
 #undef DISPLAY_C
 
@@ -52,6 +52,11 @@
   extern void LCD_Symbol(uint8_t ID);
   #endif
 
+  #ifdef LCD_PAGE_SHADOW
+  extern void LCD_DotPos(uint8_t x, uint8_t y);
+  extern void LCD_DataBlock(uint8_t *Data, uint8_t Count);
+  #endif
+
 #endif
 
 
@@ -62,11 +67,19 @@
 #ifndef SPI_C
 
   #ifdef HW_SPI
-    #ifdef SPI_HARDWARE
+    #if defined (SPI_HARDWARE) || defined (SPI_USART)
     extern void SPI_Clock(void);
     #endif
   extern void SPI_Setup(void);
-  extern void SPI_Write_Byte(uint8_t Byte);
+    #ifndef SPI_BITBANG_ASM
+    extern void SPI_Write_Byte(uint8_t Byte);
+      #ifdef SPI_FILL
+      extern void SPI_Write_Fill(uint8_t Byte, uint16_t Count);
+      #endif
+    #endif
+    #ifdef SPI_WORD
+    extern void SPI_Write_Word(uint16_t Word);
+    #endif
     #ifdef SPI_RW
     extern uint8_t SPI_WriteRead_Byte(uint8_t Byte);
     #endif
@@ -86,6 +99,15 @@
   extern uint8_t I2C_Start(uint8_t Type);
   extern uint8_t I2C_WriteByte(uint8_t Type);
   extern void I2C_Stop(void);
+    #ifdef I2C_BLOCK
+    extern uint8_t I2C_WriteBlock(uint8_t *Data, uint16_t Count);
+    #endif
+    #ifdef I2C_INTERRUPT
+    extern void I2C_Poll(void);
+    extern void I2C_Queue(I2C_Transaction_Type *Job);
+    extern uint8_t I2C_Wait(I2C_Transaction_Type *Job);
+    extern void I2C_Flush(void);
+    #endif
     #ifdef I2C_RW
     extern uint8_t I2C_ReadByte(uint8_t Type);
     #endif
@@ -103,8 +125,15 @@
   #ifdef HW_SERIAL
   extern void Serial_Setup(void);
   extern void Serial_WriteByte(uint8_t Byte);
+    #ifdef SERIAL_TX_BUFFER
+    extern void Serial_Flush(void);
+      #ifdef SERIAL_BITBANG
+      extern uint16_t Serial_TX_Wait(uint16_t Time);
+      #endif
+    #endif
     #ifdef SERIAL_RW
     void Serial_Ctrl(uint8_t Control);
+    extern void Serial_RX_Done(void);
     #endif
 
     extern void Serial_Char(unsigned char Char);
@@ -217,6 +246,29 @@
   extern void LCD_FancySemiPinout(uint8_t Line);
   #endif
 
+  #ifdef UI_TEXT_SHADOW
+  extern uint8_t Shadow_Check(unsigned char Char);
+  extern uint8_t Shadow_ClearLine(uint8_t Line, uint8_t Pos);
+  extern unsigned char Shadow_Char(uint8_t x, uint8_t y, uint16_t Color);
+  extern void Shadow_Blank(void);
+  extern void Shadow_Invalidate(uint8_t Width, uint8_t Height);
+  extern void Shadow_Clear(void);
+  extern void Shadow_Flush(uint8_t Mode);
+  #endif
+
+  #ifdef UI_GLYPH_CACHE
+  extern uint8_t *Glyph_Find(unsigned char Char);
+  extern uint8_t *Glyph_Add(unsigned char Char);
+  extern void Glyph_Run(uint8_t *Runs, uint16_t Length);
+  #endif
+
+  #ifdef LCD_PAGE_SHADOW
+  extern void Page_Reset(void);
+  extern uint8_t Page_Pos(uint8_t x, uint8_t y);
+  extern uint8_t Page_Data(uint8_t Byte);
+  extern void Page_Flush(void);
+  #endif
+
 #endif
 
 
@@ -259,6 +311,10 @@
   extern uint8_t RunCommand(uint8_t ID);
   #endif
 
+  #ifdef UI_SERIAL_TELEMETRY
+  extern void Tele_Result(void);
+  #endif
+
 #endif
 
 
@@ -278,6 +334,7 @@
   extern int8_t ShortCircuit(uint8_t Mode);
 
   extern void MarkItem(uint8_t Item, uint8_t Selected);
+  extern uint8_t MenuTool(uint8_t Items, uint8_t Type, void *Menu[], unsigned char *Unit);
   extern void MainMenu(void);
 
 #endif
@@ -350,6 +407,20 @@
   extern void Cap_Leakage(void);
   #endif
 
+  #ifdef SW_SORTER
+  extern void Sort_Tool(void);
+  #endif
+
+  #ifdef SW_STATISTICS
+  extern void Stats_Run(Stat_Type *Stats, uint8_t Mode);
+  extern void Stats_Show(Stat_Type *Stat, uint8_t Mode);
+  extern void Stats_Tool(void);
+  #endif
+
+  #ifdef SW_ADC_STREAM
+  extern void ADC_Stream(void);
+  #endif
+
 #endif
 
 
@@ -436,6 +507,8 @@
   extern void BackupProbes(void);
   extern uint8_t GetThirdProbe(uint8_t Probe1, uint8_t Probe2);
   extern uint8_t ShortedProbes(void);
+  extern void FlushOutput(void);
+  extern void PullDownProbes(void);
   extern void DischargeProbes(void);
   extern void PullProbe(uint8_t Probe, uint8_t Mode);
   extern uint16_t GetFactor(uint16_t U_in, uint8_t ID);
@@ -513,6 +586,23 @@
 #endif
 
 
+/* ************************************************************************
+ *   functions from SPI_BB.S
+ * ************************************************************************ */
+
+#ifndef SPI_BB_S
+
+  #ifdef SPI_BITBANG_ASM
+  extern void SPI_Write_Byte(uint8_t Byte);
+  extern void SPI_Write_Block(uint8_t *Data, uint16_t Count);
+    #ifdef SPI_FILL
+    extern void SPI_Write_Fill(uint8_t Byte, uint16_t Count);
+    #endif
+  #endif
+
+#endif
+
+
 /* ************************************************************************
  *   EOF
  * ************************************************************************ */
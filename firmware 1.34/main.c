@@ -1489,7 +1489,11 @@ cycle_start:
   #endif
 
   UI.LineMode = LINE_KEEP;              /* next-line mode: keep first line */
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Clear();                       /* redraw only changes */
+  #else
   LCD_Clear();                          /* clear LCD */
+  #endif
 
 
   /*
@@ -1572,6 +1576,9 @@ cycle_start:
       if (U_Bat < BAT_LOW)         /* low level reached */
       {
         Display_EEString(Low_str);      /* display: low */
+        #ifdef UI_TEXT_SHADOW
+        Shadow_Flush(SHADOW_DONE);      /* show it now */
+        #endif
         MilliSleep(2000);               /* let user read info */
         Key = KEY_POWER_OFF;            /* signal power off */
         goto cycle_action;              /* power off */
@@ -1606,8 +1613,13 @@ cycle_start:
 
   /* display start of probing */
   Display_NL_EEString(Probing_str);     /* display: probing... */
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Flush(SHADOW_UPDATE);          /* show it now */
+  #endif
 
   /* try to discharge any connected component */
+  /* probes are usually pulled down during the cycle delay */
+  Cfg.OP_Control |= OP_DISCHARGED;      /* skip waits for discharged probes */
   DischargeProbes();
   if (Check.Found == COMP_ERROR)   /* discharge failed */
   {
@@ -1639,6 +1651,9 @@ cycle_start:
     /* tell user to be patient with large caps :-) */
     Display_Space();
     Display_Char('C');    
+    #ifdef UI_TEXT_SHADOW
+    Shadow_Flush(SHADOW_UPDATE);        /* show it now */
+    #endif
 
     /* check all possible combinations */
     MeasureCap(PROBE_3, PROBE_1, 0);
@@ -1653,7 +1668,11 @@ cycle_start:
 
 show_component:
 
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Clear();                  /* redraw only changes */
+  #else
   LCD_Clear();                     /* clear LCD */
+  #endif
 
   /* next-line mode */
   Test = LINE_KEEP | LINE_KEY;     /* keep first line and wait for key/timeout */
@@ -1676,6 +1695,17 @@ show_component:
   }
   #endif
 
+  /*
+   *  Let the component discharge while the result is displayed. The
+   *  output functions for diodes, BJTs, resistors and capacitors run
+   *  further measurements, so we start after them for those.
+   */
+
+  if ((Check.Found == COMP_NONE) || (Check.Found >= COMP_FET))
+  {
+    PullDownProbes();              /* start discharging */
+  }
+
   /* call output function based on component type */
   switch (Check.Found)
   {
@@ -1734,6 +1764,18 @@ show_component:
   SerialCopy_Off();                  /* disable serial output & NL */
   #endif
 
+  /*
+   *  All measurements are done. Let the other components discharge
+   *  while we draw the pinout and wait for the next cycle.
+   *  DischargeProbes() of the next cycle will then find the probes
+   *  discharged already.
+   */
+
+  if ((Check.Found >= COMP_RESISTOR) && (Check.Found < COMP_FET))
+  {
+    PullDownProbes();              /* start discharging */
+  }
+
   #ifdef SW_SYMBOLS
   /* display fancy pinout for 3-pin semiconductors */
   if (Check.Found >= COMP_BJT)     /* 3-pin semi */
@@ -1757,6 +1799,13 @@ show_component:
   }
   #endif
 
+  #ifdef UI_SERIAL_TELEMETRY
+  if (Cfg.OP_Mode & OP_PUSH)       /* push enabled */
+  {
+    Tele_Result();                 /* send probing result */
+  }
+  #endif
+
   /* component was found */
   if (Check.Found >= COMP_RESISTOR)
   {
@@ -1777,6 +1826,9 @@ cycle_control:
   #ifdef SERIAL_RW
   Serial_Ctrl(SER_RX_RESUME);      /* enable TTL serial RX */
   #endif
+  #ifdef UI_SERIAL_COMMANDS
+  Cfg.OP_Control |= OP_RX_CMD;     /* process queued commands */
+  #endif
 
   UI.LineMode = LINE_STD;          /* reset next-line mode */
 
@@ -1837,9 +1889,15 @@ cycle_control:
 
 cycle_action:
 
-  #ifdef SERIAL_RW
-  Serial_Ctrl(SER_RX_PAUSE);       /* disable TTL serial RX */
-  /* todo: when we got a locked buffer meanwhile? */
+  #ifdef UI_SERIAL_COMMANDS
+  /* hardware USART keeps queuing commands for later */
+  Cfg.OP_Control &= ~OP_RX_CMD;    /* don't process commands */
+  #endif
+  #ifdef SERIAL_BITBANG
+    #ifdef SERIAL_RW
+    /* bit-bang RX needs Timer0 */
+    Serial_Ctrl(SER_RX_PAUSE);     /* disable TTL serial RX */
+    #endif
   #endif
 
   if (Key == KEY_MAINMENU)         /* run main menu */
@@ -1855,6 +1913,8 @@ cycle_action:
     /* todo: move this to MainMenu()? (after selecting item) */
     #endif
 
+    R_DDR = 0;                     /* remove pull-downs */
+
     MainMenu();                    /* enter main menu */
 
     #ifdef SAVE_POWER
@@ -1873,6 +1933,10 @@ cycle_action:
     #endif
     Display_EEString(Bye_str);
 
+    #ifdef SERIAL_TX_BUFFER
+    Serial_Flush();                          /* send buffered output */
+    #endif
+
     cli();                                   /* disable interrupts */
     wdt_disable();                           /* disable watchdog */
     CONTROL_PORT &= ~(1 << POWER_CTRL);      /* power off myself */
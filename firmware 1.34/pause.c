@@ -48,6 +48,12 @@ void MilliSleep(uint16_t Time)
   uint8_t                Mode;          /* sleep mode */
   #endif
 
+  #if defined (SERIAL_TX_BUFFER) && defined (SERIAL_BITBANG)
+  /* Timer2 is also used for bit-bang TX: let TX run while waiting */
+  Time = Serial_TX_Wait(Time);
+  if (Time == 0) return;           /* time is over */
+  #endif
+
   /*
    *  calculate stuff
    */
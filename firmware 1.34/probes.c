@@ -208,14 +208,58 @@ uint8_t ShortedProbes(void)
 
 
 
+/*
+ *  wait until buffered output is sent
+ *  - barrier for measurements, since TX and TWI interrupts and bit-bang
+ *    TX pin updates would interfere with timing and ADC readings
+ *  - called by DischargeProbes() and measurements without it
+ */
+
+void FlushOutput(void)
+{
+  #ifdef SERIAL_TX_BUFFER
+  Serial_Flush();                  /* send buffered output */
+  #endif
+
+  #ifdef I2C_INTERRUPT
+  I2C_Flush();                     /* run queued display transfers */
+  #endif
+}
+
+
+
+/*
+ *  set probes to a save discharge mode (pull-down via Rh and Rl)
+ *  - doesn't wait, the component discharges in the background
+ *  - DischargeProbes() checks the result and resets the probes
+ */
+
+void PullDownProbes(void)
+{
+  /* set ADC port to HiZ input */
+  ADC_DDR = 0;
+  ADC_PORT = 0;
+
+  /* all probe pins: Rh and Rl pull-down */
+  R_PORT = 0;
+  R_DDR = (1 << R_RH_1) | (1 << R_RH_2) | (1 << R_RH_3) |
+          (1 << R_RL_1) | (1 << R_RL_2) | (1 << R_RL_3);
+}
+
+
+
 /*
  *  try to discharge any connected components, e.g. capacitors
  *  - detect batteries
  *  - sometimes large caps are detected as a battery
+ *  - with OP_DISCHARGED set (main loop only) it returns immediately if
+ *    all probes are discharged already, measurement functions keep the
+ *    50ms wait for each round
  */
 
 void DischargeProbes(void)
 {
+  uint8_t           Fast;               /* skip waits for discharged probes */
   uint8_t           Counter;            /* loop control */
   uint8_t           Limit = 40;         /* sliding timeout (2s) */
   uint8_t           ID;                 /* test pin */
@@ -224,18 +268,17 @@ void DischargeProbes(void)
   uint16_t          U_old[3];           /* old voltages */
 
 
+  FlushOutput();                   /* no output while measuring */
+
   /*
    *  set probes to a save discharge mode (pull-down via Rh) 
    */
 
-  /* set ADC port to HiZ input */
-  ADC_DDR = 0;
-  ADC_PORT = 0;
+  PullDownProbes();
 
-  /* all probe pins: Rh and Rl pull-down */
-  R_PORT = 0;
-  R_DDR = (1 << R_RH_1) | (1 << R_RH_2) | (1 << R_RH_3) |
-          (1 << R_RL_1) | (1 << R_RL_2) | (1 << R_RL_3);
+  /* check for fast mode (single run) */
+  Fast = Cfg.OP_Control & OP_DISCHARGED;
+  Cfg.OP_Control &= ~OP_DISCHARGED;
 
   /* get current voltages */
   U_old[0] = ReadU(TP1);
@@ -309,8 +352,10 @@ void DischargeProbes(void)
       Check.U = U_c;                      /* save voltage */
       Counter = 0;                        /* end loop */
     }
-    else                                /* go for another round */
+    else if (! Fast || ! (DischargeMask & (1 << ID)))
     {
+      /* go for another round */
+      /* fast mode: only while probe is still charged */
       wdt_reset();                        /* reset watchdog */
       MilliSleep(50);                     /* wait for 50ms */
     }
@@ -51,6 +51,7 @@ void GetLeakageCurrent(uint8_t Mode)
   uint32_t               R_Shunt;       /* shunt resistor */
   uint16_t               U_Rl;          /* voltage at Rl */
 
+  FlushOutput();                        /* no output while measuring */
 
   /*
    *  set up probes:
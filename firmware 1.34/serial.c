@@ -62,9 +62,11 @@
   #define BIT_FE         FE0       /* Frame Error */
   #define BIT_DOR        DOR0      /* Data OverRun */
   #define BIT_UPE        UPE0      /* USART Parity Error */
+  #define BIT_U2X        U2X0      /* Double the USART Transmission Speed */
 
   #define REG_UCSR_B     UCSR0B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE0    /* RX Complete Interrupt Enable */
+  #define BIT_UDRIE      UDRIE0    /* Data Register Empty Interrupt Enable */
   #define BIT_RXEN       RXEN0     /* Receiver Enable */
   #define BIT_TXEN       TXEN0     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ02    /* USART Character Size 2 */
@@ -83,6 +85,7 @@
   #define REG_UBRR       UBRR0     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART0_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART0_UDRE_vect    /* ISR */
 #endif
 
 /* USART1 */
@@ -96,9 +99,11 @@
   #define BIT_FE         FE1       /* Frame Error */
   #define BIT_DOR        DOR1      /* Data OverRun */
   #define BIT_UPE        UPE1      /* USART Parity Error */
+  #define BIT_U2X        U2X1      /* Double the USART Transmission Speed */
 
   #define REG_UCSR_B     UCSR1B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE1    /* RX Complete Interrupt Enable */
+  #define BIT_UDRIE      UDRIE1    /* Data Register Empty Interrupt Enable */
   #define BIT_RXEN       RXEN1     /* Receiver Enable */
   #define BIT_TXEN       TXEN1     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ12    /* Character Size 0 */
@@ -117,6 +122,7 @@
   #define REG_UBRR       UBRR1     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART1_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART1_UDRE_vect    /* ISR */
 #endif
 
 
@@ -155,6 +161,80 @@
 #endif
 
 
+/* timing for bit-bang USART (SERIAL_BIT_CYCLES: MCU cycles per bit) */
+#ifdef SERIAL_BITBANG
+  /* Timer0 for sampling RX bits: prescaler 1, 8 or 64 */
+  #if SERIAL_BIT_CYCLES < 256
+    #define RX_PRESCALER   (1 << CS00)
+    #define RX_DIVIDER     1
+  #elif SERIAL_BIT_CYCLES < 2048
+    #define RX_PRESCALER   (1 << CS01)
+    #define RX_DIVIDER     8
+  #else
+    #define RX_PRESCALER   (1 << CS01) | (1 << CS00)
+    #define RX_DIVIDER     64
+  #endif
+
+  /* first sample at 46% of the bit period (early) */
+  #define RX_HALF_BIT      (SERIAL_BIT_CYCLES * 23 / 50 / RX_DIVIDER)
+  /* next samples: compensate for the runtime of the ISR (16 cycles) */
+  #define RX_FULL_BIT      ((SERIAL_BIT_CYCLES - 16) / RX_DIVIDER)
+
+  /* Timer2 for sending TX bits: prescaler 1, 8 or 32 */
+  #if SERIAL_BIT_CYCLES <= 256
+    #define TX_PRESCALER   (1 << CS20)
+    #define TX_DIVIDER     1
+  #elif SERIAL_BIT_CYCLES <= 2048
+    #define TX_PRESCALER   (1 << CS21)
+    #define TX_DIVIDER     8
+  #else
+    #define TX_PRESCALER   (1 << CS21) | (1 << CS20)
+    #define TX_DIVIDER     32
+  #endif
+
+  /* bit period (rounded) */
+  #define TX_FULL_BIT      ((SERIAL_BIT_CYCLES + TX_DIVIDER / 2) / TX_DIVIDER)
+
+  /* delay loop for blocking TX: bit period minus runtime of bit loop */
+  #define TX_LOOP_CYCLES   9
+  #define TX_DELAY         (SERIAL_BIT_CYCLES - TX_LOOP_CYCLES)
+#endif
+
+
+/* TX ring buffer */
+#define TX_BUFFER_SIZE   32        /* size of buffer */
+
+
+
+/*
+ *  local variables
+ */
+
+#ifdef SERIAL_TX_BUFFER
+/* TX ring buffer */
+uint8_t                  TX_Buffer[TX_BUFFER_SIZE];   /* ring buffer */
+uint8_t                  TX_Head = 0;                 /* next byte to send */
+volatile uint8_t         TX_Count = 0;                /* buffered bytes */
+
+  #ifdef SERIAL_BITBANG
+  /* byte currently sent */
+  uint8_t                TX_Byte;            /* TX char (bit buffer) */
+  uint8_t                TX_Bits = 0;        /* bits left for TX char */
+  volatile uint8_t       TX_Ticks = 0;       /* bit periods (wraps) */
+  #endif
+
+  #ifdef SERIAL_HARDWARE
+  /* a byte was sent since the last flush */
+  uint8_t                TX_Sent = 0;
+  #endif
+#endif
+
+#ifdef SERIAL_RW
+/* used by RX ISRs */
+void Serial_RX_Char(unsigned char Char);
+#endif
+
+
 
 /* ************************************************************************
  *   functions for software USART (bit-banging)
@@ -188,9 +268,13 @@ void Serial_Setup(void)
 
 
 
+#ifndef SERIAL_TX_BUFFER
+
 /*
  *  send byte
- *  - 9600 8N1
+ *  - 8N1, SERIAL_BAUDRATE
+ *  - bit period is a delay loop generated by the compiler
+ *    (exact number of MCU cycles)
  *
  *  requires:
  *  - Byte: byte to send
@@ -206,8 +290,7 @@ void Serial_WriteByte(uint8_t Byte)
 
   /* start bit (0/low) */
   SERIAL_PORT &= ~(1 << SERIAL_TX);     /* clear TX */
-  wait100us();                          /* delay for 9600bps */
-  wait3us();
+  __builtin_avr_delay_cycles(TX_DELAY); /* bit period */
 
   /* 8 data bits (LSB first) */
   while (n > 0)
@@ -221,8 +304,7 @@ void Serial_WriteByte(uint8_t Byte)
       SERIAL_PORT &= ~(1 << SERIAL_TX);   /* clear TX */
     }
 
-    wait100us();              /* delay for 9600bps */
-    wait3us();
+    __builtin_avr_delay_cycles(TX_DELAY);  /* bit period */
 
     Byte >>= 1;               /* shift right */
     n--;                      /* next bit */
@@ -230,12 +312,225 @@ void Serial_WriteByte(uint8_t Byte)
 
   /* 1 stop bit (1/high) and stay idle (high) */
   SERIAL_PORT |= (1 << SERIAL_TX);      /* set TX */
-  wait100us();                          /* delay for 9600bps */
-  wait3us();
+  __builtin_avr_delay_cycles(TX_DELAY); /* bit period */
+}
+
+#else
+
+
+
+/*
+ *  send next bit of TX buffer
+ *  - 8N1, SERIAL_BAUDRATE
+ *  - one bit per call, called by the Timer2 ISR at the bit rate
+ *  - stops Timer2 when the buffer is empty
+ */
+
+void Serial_TX_Step(void)
+{
+  TX_Ticks++;                 /* one more bit period */
+
+  if (TX_Bits > 1)            /* data bit */
+  {
+    if (TX_Byte & 0b00000001)      /* 1 */
+    {
+      SERIAL_PORT |= (1 << SERIAL_TX);    /* set TX */
+    }
+    else                           /* 0 */
+    {
+      SERIAL_PORT &= ~(1 << SERIAL_TX);   /* clear TX */
+    }
+
+    TX_Byte >>= 1;            /* shift right */
+    TX_Bits--;                /* next bit */
+  }
+  else if (TX_Bits == 1)      /* stop bit (1/high) */
+  {
+    SERIAL_PORT |= (1 << SERIAL_TX);      /* set TX */
+    TX_Bits = 0;              /* char done */
+  }
+  else if (TX_Count > 0)      /* next char */
+  {
+    /* get char from buffer */
+    TX_Byte = TX_Buffer[TX_Head];
+    TX_Head++;
+    if (TX_Head >= TX_BUFFER_SIZE) TX_Head = 0;
+    TX_Count--;
+
+    /* R_PORT & R_DDR / ADC_PORT & ADC_DDR can interfere (input/HiZ) */
+    SERIAL_DDR |= (1 << SERIAL_TX);       /* set TX pin to output mode */
+
+    /* start bit (0/low) */
+    SERIAL_PORT &= ~(1 << SERIAL_TX);     /* clear TX */
+    TX_Bits = 9;              /* 8 data bits + stop bit */
+  }
+  else                        /* buffer empty */
+  {
+    TCCR2B = 0;               /* stop Timer2 */
+    TIMSK2 = 0;               /* disable Timer2 interrupts */
+  }
+}
+
+
+
+/*
+ *  start sending the TX buffer if TX is idle
+ *  - 8N1, SERIAL_BAUDRATE
+ *  - uses Timer2
+ *  - call with interrupts disabled
+ */
+
+void Serial_TX_Start(void)
+{
+  if (TCCR2B != 0) return;    /* Timer2 runs already */
+
+  /*
+   *  set up Timer2 for bit period
+   *  - CTC mode, OCR2A sets TOP
+   *  - OCR2B triggers interrupt at TOP
+   *    (TIMER2_COMPA is used by MilliSleep())
+   *  - prescaler = 1, 8 or 32 (see TX_PRESCALER)
+   *    e.g. 9600bps (104.2s)
+   *    MCU clock [MHz]:    8    16    20
+   *    prescaler:          8    8     32
+   *    cycles for 104s:   104  208   65
+   *  - the timer runs on, so there's no drift caused by the ISR
+   */
+
+  TCCR2B = 0;                 /* stop timer */
+  TCNT2 = 0;                  /* reset counter to 0 */
+  TCCR2A = (1 << WGM21);      /* CTC mode */
+  OCR2A = TX_FULL_BIT - 1;    /* TOP */
+  OCR2B = TX_FULL_BIT - 1;    /* interrupt at TOP */
+  TIFR2 = (1 << OCF2B);       /* clear Output Compare B Match flag */
+  TIMSK2 = (1 << OCIE2B);     /* enable Output Compare B Match interrupt */
+
+  Serial_TX_Step();           /* send start bit of first char */
+
+  TCCR2B = TX_PRESCALER;      /* start timer by setting prescaler */
+}
+
+
+
+/*
+ *  check if TX is running
+ *
+ *  returns:
+ *  - 0 if idle
+ *  - 1 if running
+ */
+
+uint8_t Serial_TX_Busy(void)
+{
+  return (TCCR2B != 0);       /* Timer2 runs as long as we are sending */
+}
+
+
+
+/*
+ *  send next bit when interrupts are disabled
+ *  - to be called by wait loops
+ */
+
+void Serial_Poll(void)
+{
+  if (! (SREG & (1 << SREG_I)))    /* interrupts disabled */
+  {
+    if (TIFR2 & (1 << OCF2B))      /* bit period is over */
+    {
+      TIFR2 = (1 << OCF2B);        /* clear flag */
+      Serial_TX_Step();            /* next bit */
+    }
+  }
 }
 
 
 
+/*
+ *  wait while TX is running
+ *  - for MilliSleep(), since Timer2 is used for both
+ *  - the bit periods of TX are counted as elapsed time
+ *  - returns when TX is done or the time is over,
+ *    TX keeps running in the latter case
+ *
+ *  requires:
+ *  - Time: time to wait in ms
+ *
+ *  returns:
+ *  - remaining time in ms
+ */
+
+uint16_t Serial_TX_Wait(uint16_t Time)
+{
+  uint8_t           Ticks;         /* bit periods counted so far */
+  uint8_t           n;             /* new bit periods */
+  uint32_t          Cycles = 0;    /* elapsed MCU cycles */
+
+  Ticks = TX_Ticks;
+
+  while ((Time > 0) && Serial_TX_Busy())
+  {
+    wdt_reset();              /* reset watchdog */
+
+    if (SREG & (1 << SREG_I))      /* interrupts enabled */
+    {
+      #ifdef SAVE_POWER
+      /* sleep until next bit, idle mode keeps Timer2 running */
+      set_sleep_mode(SLEEP_MODE_IDLE);
+      cli();                       /* prevent race with last bit */
+      if (Serial_TX_Busy())        /* TX still running */
+      {
+        sleep_enable();
+        sei();                     /* enabled after next instruction */
+        sleep_cpu();               /* sleep */
+        sleep_disable();
+      }
+      sei();                       /* enable interrupts */
+      #endif
+    }
+    else                           /* interrupts disabled */
+    {
+      Serial_Poll();               /* run TX */
+    }
+
+    /* update time */
+    n = TX_Ticks - Ticks;          /* new bit periods */
+    Ticks += n;
+    Cycles += (uint32_t)n * (TX_FULL_BIT * TX_DIVIDER);
+    while ((Cycles >= (MCU_CYCLES_PER_US * 1000UL)) && (Time > 0))
+    {
+      Cycles -= MCU_CYCLES_PER_US * 1000UL;
+      Time--;                      /* one ms elapsed */
+    }
+  }
+
+  return Time;
+}
+
+
+
+/*
+ *  ISR for match of Timer2's OCR2B (Output Compare Register B)
+ *  - 8N1, SERIAL_BAUDRATE
+ *  - send TX bits
+ */
+
+ISR(TIMER2_COMPB_vect, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the OCF2B interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  Serial_TX_Step();           /* next bit */
+}
+
+#endif
+
+
+
 #ifdef SERIAL_RW
 
 /*
@@ -268,7 +563,7 @@ void Serial_Ctrl(uint8_t Control)
 
 /*
  *  ISR for PCIn (Pin Change Interrupt n)
- *  - 9600 8N1
+ *  - 8N1, SERIAL_BAUDRATE
  *  - for detecting start bit of RX
  *  - starts bit sampling by setting up timer
  *  - can't be used when by some measurement/tool needs Timer0
@@ -296,28 +591,24 @@ ISR(ISR_PINCHANGE, ISR_BLOCK)
      *  set up Timer0 for sampling first bit (start)
      *  - normal mode
      *  - use OCR0B for triggering interrupt
-     *  - 1/2 bit period of 9600bps = 52.08s
-     *  - fixed prescaler = 8
+     *  - 1/2 bit period, e.g. 52.08s for 9600bps
+     *  - prescaler = 1, 8 or 64 (see RX_PRESCALER)
+     *    e.g. 9600bps
      *    MCU clock [MHz]:    8    16    20
-     *    timer cycle [s]:   1    0.5   0.4
-     *    cycles for 52s:    52   104   130
+     *    prescaler:          8    8     64
+     *    cycles for 52s:    52   104   16
      *  - we don't need high precision, just good enough to sample 10 bits
-     *  - MCU_CYCLE_TIME in 0.1ns
-     *    timer cycles = (52s * 10000) / (MCU_CYCLE_TIME * 8)
-     *  - use delay of 48s for early sampling and to allow some time jittering
+     *  - sample at 46% of the bit period for early sampling and to allow
+     *    some time jittering (RX_HALF_BIT)
      */
 
-    #define HALF_BIT     480000 / (MCU_CYCLE_TIME * 8)
-
     //TCCR0B = 0;                 /* stop timer */
     TCNT0 = 0;                  /* reset counter to 0 */
-    OCR0B = HALF_BIT;           /* set match value for 1/2 bit period */
+    OCR0B = RX_HALF_BIT;        /* set match value for 1/2 bit period */
     TCCR0A = 0;                 /* normal mode (count up) */
     TIFR0 = (1 << OCF0B);       /* clear Output Compare B Match flag */
     TIMSK0 = (1 << OCIE0B);     /* enable Output Compare B Match interrupt */
-    TCCR0B = (1 << CS01);       /* start timer by setting prescaler */
-
-    #undef HALF_BIT
+    TCCR0B = RX_PRESCALER;      /* start timer by setting prescaler */
   }
   /* else: ignore pin change to 1/high */
 }
@@ -326,11 +617,10 @@ ISR(ISR_PINCHANGE, ISR_BLOCK)
 
 /*
  *  ISR for match of Timer0's OCR0B (Output Compare Register B)
- *  - 9600 8N1
+ *  - 8N1, SERIAL_BAUDRATE
  *  - sample RX bits
  *  - can't be used when by some measurement/tool needs Timer0
- *  - puts received char into a buffer
- *  - collects full text line and manages the buffer
+ *  - puts received char into the line queue
  */
 
 ISR(TIMER0_COMPB_vect, ISR_BLOCK)
@@ -379,41 +669,12 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
 
 
   /*
-   *  manage buffer
+   *  manage line queue
    */
 
   if (RX_Bits == 10)          /* got all bits */
   {
-    if (! (Cfg.OP_Control & OP_RX_LOCKED))   /* buffer unlocked */
-    {
-      if (RX_Char == '\r')              /* CR (carriage return) */
-      {
-        RX_Char = 0;                    /* terminate string */
-      }
-      else if (RX_Char == '\n')         /* NL (new line) */
-      {
-        RX_Char = 0;                    /* terminate string */
-        if (RX_Pos > 0)                 /* not an empty line */
-        {
-          Cfg.OP_Control |= OP_RX_LOCKED;    /* lock buffer for processing */
-        }
-      }
-      else if (RX_Pos == (RX_BUFFER_SIZE - 1))    /* no control char & overflow */
-      {
-        RX_Char = 0;                              /* terminate string */
-        /* lock buffer & signal overflow */
-        Cfg.OP_Control |= OP_RX_LOCKED | OP_RX_OVERFLOW;
-      }
-
-      RX_Buffer[RX_Pos] = RX_Char;      /* copy to buffer */
-
-      if (RX_Char > 0)                  /* no control char */
-      {
-        RX_Pos++;                       /* next char */
-      }
-    }
-    /* else: drop char */
-
+    Serial_RX_Char(RX_Char);  /* add char to line queue */
     RX_Bits = 0;              /* end RX */
   }
 
@@ -433,33 +694,20 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
     /*
      *  set up Timer0 for sampling next bit (data or stop)
      *  - keep basic settings from RX pin change ISR 
-     *  - bit period of 9600bps = 104.1s
-     *  - fixed prescaler = 8 (<=16MHz) or 64 (>16MHz)
+     *  - bit period, e.g. 104.1s for 9600bps
+     *  - prescaler = 1, 8 or 64 (see RX_PRESCALER)
+     *    e.g. 9600bps
      *    MCU clock [MHz]:    8    16    20
-     *    timer cycle [s]:   1    0.5   3.2
+     *    prescaler:          8    8     64
      *    cycles for 104s:   104  208   32.5
      *  - we don't need high precision, just good enough to sample 10 bits
-     *  - MCU_CYCLE_TIME in 0.1ns
-     *    timer cycles = (104s * 10000) / (MCU_CYCLE_TIME * prescaler)
-     *  - use a delay of 102s to compensate for the runtime of this ISR
+     *  - subtract 16 MCU cycles to compensate for the runtime of this ISR
+     *    (RX_FULL_BIT)
      */
 
-    #if CPU_FREQ <= 16000000       /* <= 16MHz */
-      /* prescaler 8 */
-      #define FULL_BIT        1020000 / (MCU_CYCLE_TIME * 8)
-      #define PRESCALER       (1 << CS01)
-    #else                          /* > 16MHz */
-      /* prescaler 64 */
-      #define FULL_BIT        1020000 / (MCU_CYCLE_TIME * 64)
-      #define PRESCALER       (1 << CS01) | (1 << CS00)
-    #endif
-
     TCNT0 = 0;                /* reset counter to 0 */
-    OCR0B = FULL_BIT;         /* set match value for bit period */
-    TCCR0B = PRESCALER;       /* start timer by setting prescaler */
-
-    #undef FULL_BIT
-    #undef PRESCALER
+    OCR0B = RX_FULL_BIT;      /* set match value for bit period */
+    TCCR0B = RX_PRESCALER;    /* start timer by setting prescaler */
   }
 }
 
@@ -478,20 +726,22 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
 
 /*
  *  set up serial interface
- *  - 9600 8N1
+ *  - 8N1, SERIAL_BAUDRATE
  *  - TX & RX line
  */
 
 void Serial_Setup(void)
 {
   /*
-   *  asynchronous normal mode
-   *  - prescaler = (f_MCU / (16 * bps)) - 1
-   *  - 2400bps, 8 data bits, no parity, 1 stop bit
+   *  asynchronous double speed mode (U2X)
+   *  - prescaler = (f_MCU / (8 * bps)) - 1, rounded (SERIAL_UBRR)
+   *  - finer steps than normal mode, allows up to 250kbps at 8MHz
+   *  - 8 data bits, no parity, 1 stop bit
    *  - overrides normal port operation of Tx pin and Rx pin (if enabled)
    */
 
-  REG_UBRR = (CPU_FREQ / (16UL * 9600)) - 1;
+  REG_UCSR_A = (1 << BIT_U2X);
+  REG_UBRR = SERIAL_UBRR;
   REG_UCSR_C = (1 << BIT_UCSZ_1) | (1 << BIT_UCSZ_0);
 
   #ifdef SERIAL_RW
@@ -511,9 +761,11 @@ void Serial_Setup(void)
 
 
 
+#ifndef SERIAL_TX_BUFFER
+
 /*
  *  send byte
- *  - 9600 8N1 (set by Serial_Setup())
+ *  - 8N1, SERIAL_BAUDRATE (set by Serial_Setup())
  *
  *  requires:
  *  - Byte: byte to send
@@ -531,6 +783,122 @@ void Serial_WriteByte(uint8_t Byte)
   REG_UDR = Byte;
 }
 
+#else
+
+
+
+/*
+ *  move next byte of TX buffer to the USART
+ *  - called by the UDRE ISR when the USART's Tx buffer is empty
+ *  - disables the UDRE interrupt when the buffer is empty
+ */
+
+void Serial_TX_Step(void)
+{
+  if (TX_Count > 0)           /* buffered byte */
+  {
+    /* copy byte to Tx buffer, triggers sending */
+    REG_UDR = TX_Buffer[TX_Head];
+    TX_Head++;
+    if (TX_Head >= TX_BUFFER_SIZE) TX_Head = 0;
+    TX_Count--;
+
+    /* clear USART Transmit Complete flag (for Serial_Flush()) */
+    REG_UCSR_A |= (1 << BIT_TXC);
+    TX_Sent = 1;
+  }
+
+  if (TX_Count == 0)          /* buffer empty */
+  {
+    REG_UCSR_B &= ~(1 << BIT_UDRIE);     /* disable UDRE interrupt */
+  }
+}
+
+
+
+/*
+ *  start sending the TX buffer if TX is idle
+ *  - call with interrupts disabled
+ */
+
+void Serial_TX_Start(void)
+{
+  /* the UDRE interrupt triggers as soon as the Tx buffer is empty */
+  REG_UCSR_B |= (1 << BIT_UDRIE);        /* enable UDRE interrupt */
+}
+
+
+
+/*
+ *  check if TX is running
+ *
+ *  returns:
+ *  - 0 if idle
+ *  - 1 if running
+ */
+
+uint8_t Serial_TX_Busy(void)
+{
+  if (REG_UCSR_B & (1 << BIT_UDRIE))     /* buffer not empty yet */
+  {
+    return 1;
+  }
+
+  if (TX_Sent)                           /* last byte might be on the line */
+  {
+    if (! (REG_UCSR_A & (1 << BIT_TXC))) /* not completely sent */
+    {
+      return 1;
+    }
+
+    TX_Sent = 0;                         /* all done */
+  }
+
+  return 0;
+}
+
+
+
+/*
+ *  move next byte to the USART when interrupts are disabled
+ *  - to be called by wait loops
+ */
+
+void Serial_Poll(void)
+{
+  if (! (SREG & (1 << SREG_I)))    /* interrupts disabled */
+  {
+    if ((REG_UCSR_B & (1 << BIT_UDRIE)) &&    /* TX running */
+        (REG_UCSR_A & (1 << BIT_UDRE)))       /* USART's Tx buffer empty */
+    {
+      Serial_TX_Step();            /* next byte */
+    }
+  }
+}
+
+
+
+/*
+ *  ISR for UDREn (USART Data Register Empty n)
+ *  - moves next byte of TX buffer to the USART
+ */
+
+ISR(ISR_USART_UDRE, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the UDREn flag is cleared by writing UDRn
+   *    if the buffer is empty the interrupt is disabled instead,
+   *    otherwise it would retrigger
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  Serial_TX_Step();           /* next byte */
+}
+
+#endif
+
 
 
 #ifdef SERIAL_RW
@@ -564,9 +932,8 @@ void Serial_Ctrl(uint8_t Control)
 
 /*
  *  ISR for RXCn (Receive Complete n)
- *  - 9600 8N1 (set by Serial_Setup())
- *  - retrieves received character and puts it into a buffer
- *  - collects full text line and manages the buffer
+ *  - 8N1, SERIAL_BAUDRATE (set by Serial_Setup())
+ *  - retrieves received character and puts it into the line queue
  */
 
 ISR(ISR_USART_RX, ISR_BLOCK)
@@ -586,38 +953,76 @@ ISR(ISR_USART_RX, ISR_BLOCK)
 
   Char = REG_UDR;                       /* get received char & clear flag */
 
-  if (! (Cfg.OP_Control & OP_RX_LOCKED))     /* buffer unlocked */
-  {
-    if (Char == '\r')                   /* CR (carriage return) */
-    {
-      Char = 0;                         /* terminate string */
-    }
-    else if (Char == '\n')              /* NL (new line) */
-    {
-      Char = 0;                         /* terminate string */
-      if (RX_Pos > 0)                   /* not an empty line */
-      {
-        Cfg.OP_Control |= OP_RX_LOCKED;      /* lock buffer for processing */
-      }
-    }
-    else if (RX_Pos == (RX_BUFFER_SIZE - 1))  /* no control char & overflow */
-    {
-      Char = 0;                               /* terminate string */
-      /* lock buffer & signal overflow */
-      Cfg.OP_Control |= OP_RX_LOCKED | OP_RX_OVERFLOW;
-    }
+  Serial_RX_Char(Char);                 /* add char to line queue */
+}
 
-    RX_Buffer[RX_Pos] = Char;           /* copy to buffer */
+#endif
 
-    if (Char > 0)                       /* no control char */
-    {
-      RX_Pos++;                         /* next char */
-    }
+#endif
+
+
+
+/* ************************************************************************
+ *   buffered TX
+ * ************************************************************************ */
+
+
+#ifdef SERIAL_TX_BUFFER
+
+/*
+ *  wait until all buffered bytes are sent
+ *  - flush barrier for timing sensitive stuff, e.g. probing
+ *    (TX interrupts and bit-bang TX pin updates would interfere)
+ */
+
+void Serial_Flush(void)
+{
+  while (Serial_TX_Busy())         /* as long as we are sending */
+  {
+    Serial_Poll();                 /* keep TX running if needed */
   }
-  /* else: drop char, otherwise it would block the firmware */
 }
 
-#endif
+
+
+/*
+ *  send byte
+ *  - 8N1, SERIAL_BAUDRATE
+ *  - puts byte into TX buffer and returns immediately
+ *  - waits only if the buffer is full
+ *  - sends byte at once if interrupts are disabled
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Serial_WriteByte(uint8_t Byte)
+{
+  uint8_t           Pos;           /* position in buffer */
+  uint8_t           Flag;          /* status register */
+
+  /* wait for free slot */
+  while (TX_Count >= TX_BUFFER_SIZE) Serial_Poll();
+
+  Flag = SREG;                     /* save status */
+  cli();                           /* disable interrupts */
+
+  /* add byte to buffer */
+  Pos = TX_Head + TX_Count;
+  if (Pos >= TX_BUFFER_SIZE) Pos -= TX_BUFFER_SIZE;
+  TX_Buffer[Pos] = Byte;
+  TX_Count++;
+
+  Serial_TX_Start();               /* make sure TX is running */
+
+  SREG = Flag;                     /* restore status (and interrupts) */
+
+  /* no interrupts: nobody would empty the buffer */
+  if (! (Flag & (1 << SREG_I)))    /* interrupts disabled */
+  {
+    Serial_Flush();                /* send byte right now */
+  }
+}
 
 #endif
 
@@ -700,11 +1105,141 @@ void Serial_NewLine(void)
  * ************************************************************************ */
 
 
+#ifdef SERIAL_RW
+
+/*
+ *  add received char to the line queue
+ *  - called by the RX ISRs
+ *  - CR is ignored, LF ends a line (empty lines are ignored)
+ *  - a line too long is marked as overflow, the remaining chars are dropped
+ *  - a line not fitting into the full queue is lost and counted for the
+ *    preceding line, so it's answered in order
+ *  - processing of a line doesn't block the reception of the next ones
+ *
+ *  requires:
+ *  - Char: received character
+ */
+
+void Serial_RX_Char(unsigned char Char)
+{
+  uint8_t           Slot;          /* slot for current line */
+  uint8_t           *Lost;         /* counter of lost lines */
+
+  /* current line goes into the next free slot */
+  Slot = RX_Head + RX_Lines;
+  if (Slot >= RX_LINES) Slot -= RX_LINES;
+
+  if (Char == '\r')                 /* CR (carriage return) */
+  {
+    /* ignore */
+  }
+  else if (Char == '\n')            /* NL (new line) */
+  {
+    if (RX_State & RX_LINE_LOST)         /* no free slot */
+    {
+      if (RX_Lines > 0)                  /* follows last queued line */
+      {
+        if (Slot == 0) Slot = RX_LINES;
+        Lost = &RX_Lost[Slot - 1];
+      }
+      else                               /* queue processed meanwhile */
+      {
+        Lost = (uint8_t *)&RX_Dropped;
+      }
+
+      if (*Lost < 255) (*Lost)++;        /* signal lost line */
+    }
+    else if (RX_Pos > 0)                 /* not an empty line */
+    {
+      RX_Buffer[Slot][RX_Pos] = 0;       /* terminate string */
+
+      /* keep overflow state */
+      if (RX_State & RX_LINE_OVERFLOW)   /* line too long */
+      {
+        RX_Overflow |= (1 << Slot);      /* set flag */
+      }
+      else                               /* line ok */
+      {
+        RX_Overflow &= ~(1 << Slot);     /* clear flag */
+      }
+
+      RX_Lines++;                        /* add line to queue */
+    }
+
+    /* start new line */
+    RX_Pos = 0;
+    RX_State = 0;
+  }
+  else if ((RX_State & RX_LINE_LOST) || (RX_Lines >= RX_LINES))
+  {
+    /* queue full: drop char */
+    RX_State |= RX_LINE_LOST;            /* line is lost */
+  }
+  else if (RX_Pos < (RX_BUFFER_SIZE - 1))     /* free space in slot */
+  {
+    RX_Buffer[Slot][RX_Pos] = Char;      /* copy to buffer */
+    RX_Pos++;                            /* next char */
+  }
+  else                                   /* line too long */
+  {
+    /* drop char */
+    RX_State |= RX_LINE_OVERFLOW;        /* signal overflow */
+  }
+}
+
+
+
+/*
+ *  remove oldest line from the line queue
+ *  - or a lost line if one is due
+ *  - lines lost after the removed line are due next
+ *  - to be called after the line is processed
+ */
+
+void Serial_RX_Done(void)
+{
+  uint8_t           Flag;          /* status register */
+
+  Flag = SREG;                     /* save status */
+  cli();                           /* disable interrupts */
+
+  if (RX_Dropped > 0)              /* lost line */
+  {
+    RX_Dropped--;
+  }
+  else if (RX_Lines > 0)           /* got line */
+  {
+    RX_Dropped = RX_Lost[RX_Head]; /* lost lines following this one */
+    RX_Lost[RX_Head] = 0;
+    RX_Head++;                     /* next line */
+    if (RX_Head >= RX_LINES) RX_Head = 0;
+    RX_Lines--;
+  }
+
+  SREG = Flag;                     /* restore status (and interrupts) */
+}
+
+#endif
+
+
 
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
 
+/* bit-bang timing */
+#ifdef SERIAL_BITBANG
+  #undef RX_PRESCALER
+  #undef RX_DIVIDER
+  #undef RX_HALF_BIT
+  #undef RX_FULL_BIT
+  #undef TX_PRESCALER
+  #undef TX_DIVIDER
+  #undef TX_FULL_BIT
+  #undef TX_LOOP_CYCLES
+  #undef TX_DELAY
+#endif
+
 /* source management */
 #undef SERIAL_C
 
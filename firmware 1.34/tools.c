@@ -50,6 +50,18 @@ uint8_t                SweepStep;       /* sweep step */
 volatile uint8_t       SweepDir;        /* sweep direction */
 #endif
 
+#ifdef SW_ADC_STREAM
+uint16_t               StreamBuffer[2][STREAM_SAMPLES];  /* double buffer */
+uint8_t                StreamSeq[2];    /* sequence numbers of halves */
+uint8_t                StreamMode;      /* mode flags and probe */
+uint8_t                StreamHalf;      /* half being filled */
+uint8_t                StreamPos;       /* next sample in half */
+uint8_t                StreamCount;     /* next sequence number */
+uint8_t                StreamSkip;      /* flag: skip current block */
+volatile uint8_t       StreamFull;      /* halves ready to send (bitmask) */
+uint16_t               StreamCRC;       /* CRC of current frame */
+#endif
+
 
 
 /* ************************************************************************
@@ -101,6 +113,49 @@ void ProbePinout(uint8_t Mode)
 
 
 
+#if defined (SW_SORTER) || defined (SW_STATISTICS)
+
+/*
+ *  reset component data and discharge probes before probing
+ *  - same as at the start of the main cycle
+ *
+ *  returns:
+ *  - 1 if ready for probing
+ *  - 0 on discharge error
+ */
+
+uint8_t ResetProbing(void)
+{
+  uint8_t           Flag = 1;           /* return value */
+
+  /* reset variables */
+  Check.Found = COMP_NONE;         /* no component */
+  Check.Type = 0;                  /* reset type flags */
+  Check.Done = DONE_NONE;
+  Check.AltFound = COMP_NONE;      /* no alternative component */
+  Check.Diodes = 0;                /* zero diodes */
+  Check.Resistors = 0;             /* zero resistors */
+  Semi.U_1 = 0;                    /* reset value */
+  Semi.U_2 = 0;
+  Semi.F_1 = 0;
+  Semi.I_value = 0;
+  AltSemi.U_1 = 0;
+  AltSemi.U_2 = 0;
+
+  /* try to discharge any connected component */
+  DischargeProbes();
+  if (Check.Found == COMP_ERROR)   /* discharge failed */
+  {
+    Flag = 0;
+  }
+
+  return Flag;
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   PWM
  * ************************************************************************ */
@@ -3367,6 +3422,1189 @@ void Cap_Leakage(void)
 
 
 
+/* ************************************************************************
+ *   bin sorter
+ * ************************************************************************ */
+
+
+#ifdef SW_SORTER
+
+/* local constants */
+#define SORT_FAIL        NUM_SORT_BINS  /* bin ID for rejected parts */
+#define SORT_PASSES      3              /* max. number of passes per part */
+#define SORT_GUARD       2              /* guard band around bin limits (0.1%) */
+#define SORT_DELAY       50             /* delay between scans (ms) */
+
+
+/*
+ *  calculate checksum for sorter reference
+ *
+ *  requires:
+ *  - pointer to reference
+ */
+
+uint8_t Sort_CheckSum(Sort_Type *Ref)
+{
+  uint8_t           Checksum = 0;       /* checksum / return value */
+  uint8_t           n;                  /* counter */
+  uint8_t           *Data;              /* pointer to RAM */
+
+  /* we simply add all bytes, besides the checksum */
+  Data = (uint8_t *)Ref;
+  for (n = 0; n < (sizeof(Sort_Type) - 1); n++)
+  {
+    Checksum += *Data;        /* add byte */
+    Data++;                   /* next byte */
+  }
+
+  /* fix for zero (not updated yet) */
+  if (Checksum == 0) Checksum++;
+
+  return Checksum;
+}
+
+
+
+/*
+ *  load/save sorter reference from/to EEPROM
+ *
+ *  requires:
+ *  - pointer to reference
+ *  - mode: load/save
+ *    STORAGE_LOAD  load data from EEPROM to RAM
+ *    STORAGE_SAVE  save data from RAM to EEPROM
+ */
+
+void Sort_Storage(Sort_Type *Ref, uint8_t Mode)
+{
+  if (Mode == STORAGE_SAVE)        /* write */
+  {
+    Ref->CheckSum = Sort_CheckSum(Ref);      /* update checksum */
+    eeprom_write_block((void *)Ref, (void *)&NV_Sort, sizeof(Sort_Type));
+  }
+  else                             /* read */
+  {
+    eeprom_read_block((void *)Ref, (void *)&NV_Sort, sizeof(Sort_Type));
+
+    /* no valid reference: not taught yet or checksum mismatch */
+    if (Ref->CheckSum != Sort_CheckSum(Ref))
+    {
+      Ref->Type = COMP_NONE;       /* reset type */
+    }
+  }
+}
+
+
+
+/*
+ *  probe part with the minimum number of checks for the given type
+ *  - resistor: single check of probe #1 and probe #3
+ *  - capacitor: single measurement of probe #1 and probe #3
+ *  - BJT: all probe combinations (pinout is unknown)
+ *
+ *  requires:
+ *  - component type (COMP_*)
+ *  - pointer to value
+ *  - pointer to scale
+ *
+ *  returns:
+ *  - 1 on success (value and scale updated)
+ *  - 0 if no matching part was found
+ */
+
+uint8_t Sort_Probe(uint8_t Type, uint32_t *Value, int8_t *Scale)
+{
+  uint8_t           Flag = 0;           /* return value */
+
+  if (ResetProbing() == 0)         /* discharge failed */
+  {
+    return Flag;                   /* skip checks */
+  }
+
+  switch (Type)
+  {
+    case COMP_RESISTOR:
+      if (CheckSingleResistor(PROBE_1, PROBE_3, 0) == 1)
+      {
+        *Value = Resistors[0].Value;
+        *Scale = Resistors[0].Scale;
+        Flag = 1;
+      }
+      break;
+
+    case COMP_CAPACITOR:
+      MeasureCap(PROBE_1, PROBE_3, 0);  /* probe-1 = Vcc, probe-3 = Gnd */
+      if (Check.Found == COMP_CAPACITOR)
+      {
+        *Value = Caps[0].Value;
+        *Scale = Caps[0].Scale;
+        Flag = 1;
+      }
+      break;
+
+    case COMP_BJT:
+      /* check all 6 combinations of the 3 probes */
+      CheckProbes(PROBE_1, PROBE_2, PROBE_3);
+      CheckProbes(PROBE_2, PROBE_1, PROBE_3);
+      CheckProbes(PROBE_1, PROBE_3, PROBE_2);
+      CheckProbes(PROBE_3, PROBE_1, PROBE_2);
+      CheckProbes(PROBE_2, PROBE_3, PROBE_1);
+      CheckProbes(PROBE_3, PROBE_2, PROBE_1);
+      if (Check.Found == COMP_BJT)
+      {
+        *Value = Semi.F_1;              /* hFE */
+        *Scale = 0;
+        Flag = 1;
+      }
+      break;
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  get deviation from reference value
+ *
+ *  requires:
+ *  - pointer to reference
+ *  - value and scale of part
+ *
+ *  returns:
+ *  - absolute deviation in 0.1%
+ *  - UINT16_MAX if value is below 50% or above 200% of reference
+ */
+
+uint16_t Sort_Deviation(Sort_Type *Ref, uint32_t Value, int8_t Scale)
+{
+  uint32_t          Nominal;            /* reference value */
+
+  Nominal = Ref->Value;
+
+  /* way off (halve values instead of doubling them to prevent an overflow) */
+  if ((Nominal == 0) ||
+      (CmpValue(Value / 2, Scale, Nominal, Ref->Scale) == 1) ||
+      (CmpValue(Value, Scale, Nominal / 2, Ref->Scale) == -1))
+  {
+    return UINT16_MAX;
+  }
+
+  /* both values have the same magnitude now, so rescaling is safe */
+  Value = RescaleValue(Value, Scale, Ref->Scale);
+
+  /* limit resolution to prevent an overflow below */
+  while (Nominal > 100000)
+  {
+    Nominal /= 10;
+    Value /= 10;
+  }
+
+  if (Value > Nominal) Value -= Nominal;
+  else Value = Nominal - Value;
+
+  Value *= 1000;              /* scale to 0.1% */
+  Value /= Nominal;
+
+  return (uint16_t)Value;
+}
+
+
+
+/*
+ *  get bin for a deviation
+ *
+ *  requires:
+ *  - deviation in 0.1%
+ *
+ *  returns:
+ *  - bin ID (0 - NUM_SORT_BINS-1)
+ *  - SORT_FAIL if outside of all bins
+ */
+
+uint8_t Sort_Bin(uint16_t Deviation)
+{
+  uint8_t           n = 0;              /* bin ID / return value */
+
+  while (n < NUM_SORT_BINS)
+  {
+    if (Deviation <= eeprom_read_word(&Sort_Bin_table[n])) break;
+    n++;
+  }
+
+  return n;
+}
+
+
+
+/*
+ *  display value of sorted part
+ *
+ *  requires:
+ *  - component type (COMP_*)
+ *  - value and scale
+ */
+
+void Sort_ShowValue(uint8_t Type, uint32_t Value, int8_t Scale)
+{
+  uint8_t           Unit = 0;           /* unit (none for hFE) */
+
+  if (Type == COMP_RESISTOR) Unit = LCD_CHAR_OMEGA;
+  else if (Type == COMP_CAPACITOR) Unit = 'F';
+
+  Display_Value(Value, Scale, Unit);
+}
+
+
+
+/*
+ *  display bin label
+ *
+ *  requires:
+ *  - bin ID
+ */
+
+void Sort_ShowBin(uint8_t Bin)
+{
+  if (Bin == SORT_FAIL)            /* rejected */
+  {
+    Display_EEString(SortFail_str);     /* display: fail */
+  }
+  else                             /* valid bin */
+  {
+    Display_Char('B');
+    Display_Char('1' + Bin);            /* bins start at 1 */
+  }
+}
+
+
+
+/*
+ *  bin sorter
+ *  - sorts parts into tolerance bins around a reference value
+ *  - resistors and capacitors have to be connected to probe #1 and #3
+ *  - a new part is sorted once, after removing it the sorter is
+ *    ready for the next one
+ *  - short key press: show counters
+ *  - long key press: teach reference by the connected part
+ *  - two short key presses: exit
+ */
+
+void Sort_Tool(void)
+{
+  uint8_t           Flag;               /* loop control flag */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Line;               /* line for verdict */
+  uint8_t           Bin;                /* bin ID */
+  uint8_t           n;                  /* counter */
+  int8_t            Scale;              /* scale of measured value */
+  uint32_t          Value;              /* measured value */
+  uint16_t          Deviation;          /* deviation (0.1%) */
+  uint16_t          Sum;                /* sum of deviations */
+  Sort_Type         Ref;                /* reference */
+  uint16_t          Counter[NUM_SORT_BINS + 1];   /* counters incl. fail */
+
+  /* control flags */
+  #define RUN_FLAG            0b00000001     /* run flag */
+  #define PART_PRESENT        0b00000010     /* part is connected */
+  #define CHANGED_REF         0b00000100     /* reference has changed */
+  #define SHOW_SCREEN         0b00001000     /* redraw screen */
+
+  /* verdict goes to line #3, or to line #2 on 2-line displays */
+  Line = 3;
+  if (UI.CharMax_Y < 3) Line = 2;
+
+  Sort_Storage(&Ref, STORAGE_LOAD);     /* load reference */
+  Flag = RUN_FLAG | CHANGED_REF | SHOW_SCREEN;
+
+  while (Flag > 0)            /* processing loop */
+  {
+    /* reset counters */
+    if (Flag & CHANGED_REF)
+    {
+      n = 0;
+      while (n <= NUM_SORT_BINS)
+      {
+        Counter[n] = 0;
+        n++;
+      }
+
+      Flag &= ~CHANGED_REF;        /* clear flag */
+    }
+
+    /* display tool and reference */
+    if (Flag & SHOW_SCREEN)
+    {
+      LCD_Clear();
+      Display_EEString(Sorter_str);     /* display: Sorter */
+      LCD_CharPos(1, 2);
+      Display_EEString_Space(SortRef_str);   /* display: Ref */
+      if (Ref.Type == COMP_NONE)        /* no reference yet */
+      {
+        Display_Char('-');
+      }
+      else                              /* valid reference */
+      {
+        Sort_ShowValue(Ref.Type, Ref.Value, Ref.Scale);
+      }
+
+      Flag &= ~SHOW_SCREEN;        /* clear flag */
+    }
+
+
+    /*
+     *  probe and sort part
+     */
+
+    if (Sort_Probe(Ref.Type, &Value, &Scale))     /* got part */
+    {
+      if (! (Flag & PART_PRESENT))      /* new part */
+      {
+        /*
+         *  Take further passes only if the deviation is so close to a
+         *  bin limit that the guard band covers two bins.
+         */
+
+        Sum = 0;
+        n = 0;
+        while (n < SORT_PASSES)
+        {
+          if (n > 0)                    /* additional pass */
+          {
+            if (Sort_Probe(Ref.Type, &Value, &Scale) == 0) break;
+          }
+
+          Deviation = Sort_Deviation(&Ref, Value, Scale);
+          n++;
+
+          if (Deviation == UINT16_MAX)  /* way off */
+          {
+            Sum = Deviation;            /* reject */
+            n = 1;
+            break;
+          }
+
+          Sum += Deviation;             /* max. 3 * 1000 */
+          Deviation = Sum / n;          /* average */
+
+          /* check if both ends of the guard band fall into the same bin */
+          Test = Sort_Bin(Deviation + SORT_GUARD);
+          if (Deviation > SORT_GUARD) Deviation -= SORT_GUARD;
+          else Deviation = 0;
+          if (Sort_Bin(Deviation) == Test) break;
+        }
+
+        Bin = Sort_Bin(Sum / n);        /* get bin */
+        Counter[Bin]++;                 /* and update its counter */
+
+        /* display verdict: bin, value and counter */
+        LCD_ClearLine(Line);
+        LCD_CharPos(1, Line);
+        #ifdef UI_SERIAL_COPY
+        SerialCopy_On();                /* enable serial output & NL */
+        #endif
+        Sort_ShowBin(Bin);
+        Display_Space();
+        Sort_ShowValue(Ref.Type, Value, Scale);
+        Display_Space();
+        Display_Value(Counter[Bin], 0, 0);
+        #ifdef UI_SERIAL_COPY
+        SerialCopy_Off();               /* disable serial output & NL */
+        #endif
+
+        Flag |= PART_PRESENT;           /* wait for removal */
+      }
+    }
+    else                                /* no part */
+    {
+      Flag &= ~PART_PRESENT;            /* ready for next part */
+    }
+
+
+    /*
+     *  user feedback
+     */
+
+    Test = TestKey(SORT_DELAY, CURSOR_NONE);
+
+    if (Test == KEY_SHORT)              /* short key press */
+    {
+      MilliSleep(50);                   /* debounce button a little bit longer */
+      Test = TestKey(200, CURSOR_NONE); /* check for second key press */
+      if (Test > KEY_TIMEOUT)           /* second key press */
+      {
+        Flag = 0;                       /* end loop */
+      }
+      else                              /* single key press */
+      {
+        /* show counters */
+        LCD_Clear();
+        Display_EEString(Sorter_str);   /* display: Sorter */
+        UI.LineMode = LINE_KEEP | LINE_KEY;
+        n = 0;
+        while (n <= NUM_SORT_BINS)
+        {
+          Display_NextLine();
+          Sort_ShowBin(n);
+          Display_Space();
+          Display_Value(Counter[n], 0, 0);
+          n++;
+        }
+        UI.LineMode = LINE_STD;
+        TestKey(0, CURSOR_BLINK);       /* wait for key press */
+
+        Flag |= SHOW_SCREEN;            /* redraw screen */
+      }
+    }
+    else if (Test == KEY_LONG)          /* long key press */
+    {
+      /* teach reference by connected part */
+      LCD_ClearLine(Line);
+      LCD_CharPos(1, Line);
+      Display_EEString(Probing_str);    /* display: probing... */
+
+      Test = COMP_RESISTOR;             /* try resistor first */
+      n = 0;
+      while (Test != COMP_NONE)
+      {
+        if (Sort_Probe(Test, &Value, &Scale))     /* found part */
+        {
+          Ref.Type = Test;
+          Ref.Scale = Scale;
+          Ref.Value = Value;
+          Sort_Storage(&Ref, STORAGE_SAVE);       /* save reference */
+          Flag |= CHANGED_REF | SHOW_SCREEN;
+          n = 1;
+          break;
+        }
+
+        /* next type */
+        if (Test == COMP_RESISTOR) Test = COMP_CAPACITOR;
+        else if (Test == COMP_CAPACITOR) Test = COMP_BJT;
+        else Test = COMP_NONE;
+      }
+
+      if (n == 0)                       /* no suitable part */
+      {
+        LCD_ClearLine(Line);
+        LCD_CharPos(1, Line);
+        Display_EEString(Error_str);    /* display: Error */
+      }
+
+      Flag |= PART_PRESENT;             /* don't sort reference part */
+    }
+  }
+
+  /* clean up */
+  #undef RUN_FLAG
+  #undef PART_PRESENT
+  #undef CHANGED_REF
+  #undef SHOW_SCREEN
+}
+
+
+/* clean up */
+#undef SORT_FAIL
+#undef SORT_PASSES
+#undef SORT_GUARD
+#undef SORT_DELAY
+
+#endif
+
+
+
+/* ************************************************************************
+ *   statistics of repeated measurements
+ * ************************************************************************ */
+
+
+#ifdef SW_STATISTICS
+
+/*
+ *  integer square root
+ *
+ *  requires:
+ *  - Value: radicand
+ *
+ *  returns:
+ *  - square root (rounded down)
+ */
+
+uint16_t SquareRoot(uint32_t Value)
+{
+  uint32_t          Root = 0;           /* result */
+  uint32_t          Bit;                /* current bit */
+
+  /* start with highest power of 4 not larger than value */
+  Bit = (uint32_t)1 << 30;
+  while (Bit > Value) Bit >>= 2;
+
+  /* digit by digit method */
+  while (Bit != 0)
+  {
+    if (Value >= Root + Bit)
+    {
+      Value -= Root + Bit;
+      Root = (Root >> 1) + Bit;
+    }
+    else
+    {
+      Root >>= 1;
+    }
+
+    Bit >>= 2;
+  }
+
+  return (uint16_t)Root;
+}
+
+
+
+/*
+ *  add sample to statistics
+ *  - Welford's method with fixed point values
+ *  - first sample sets scale of all following samples
+ *
+ *  requires:
+ *  - Stat: pointer to statistics
+ *  - Name: name string (EEPROM)
+ *  - Unit: unit character
+ *  - Value: measured value
+ *  - Scale: exponent of factor (value * 10^x)
+ */
+
+void Stats_Add(Stat_Type *Stat, const unsigned char *Name,
+  unsigned char Unit, uint32_t Value, int8_t Scale)
+{
+  uint16_t          Sample;             /* normalized sample */
+  int32_t           Delta;              /* difference to old mean */
+  int32_t           Delta2;             /* difference to new mean */
+  uint32_t          Square;             /* squared difference */
+
+  if (Stat->Count == 0)            /* first sample */
+  {
+    /* reduce value to 16 bits */
+    while (Value > UINT16_MAX)
+    {
+      Value /= 10;
+      Scale++;
+    }
+
+    Stat->Name = Name;
+    Stat->Unit = Unit;
+    Stat->Scale = Scale;
+    Stat->Min = UINT16_MAX;
+    Stat->Max = 0;
+    Stat->Mean = 0;
+    Stat->M2 = 0;
+  }
+  else                             /* following samples */
+  {
+    /* adapt value to scale of first sample */
+    if (CmpValue(Value, Scale, UINT16_MAX, Stat->Scale) == 1)
+    {
+      Value = UINT16_MAX;          /* limit to maximum */
+    }
+    else
+    {
+      Value = RescaleValue(Value, Scale, Stat->Scale);
+    }
+  }
+
+  Sample = (uint16_t)Value;
+
+  /* update counter and range */
+  if (Stat->Count < UINT8_MAX) Stat->Count++;
+  if (Sample < Stat->Min) Stat->Min = Sample;
+  if (Sample > Stat->Max) Stat->Max = Sample;
+
+  /* update mean */
+  Delta = ((int32_t)Sample << 4) - Stat->Mean;
+  Stat->Mean += Delta / Stat->Count;
+  Delta2 = ((int32_t)Sample << 4) - Stat->Mean;
+
+  /* update sum of squared differences (saturating) */
+  if (Delta < 0) Delta = -Delta;
+  if (Delta2 < 0) Delta2 = -Delta2;
+  if ((Delta == 0) || (Delta2 == 0))    /* e.g. first sample */
+  {
+    Square = 0;
+  }
+  else if ((uint32_t)Delta > UINT32_MAX / (uint32_t)Delta2)
+  {
+    Square = UINT32_MAX;           /* product would overflow */
+  }
+  else
+  {
+    Square = (uint32_t)Delta * (uint32_t)Delta2;
+  }
+
+  if (Stat->M2 > UINT32_MAX - Square) Stat->M2 = UINT32_MAX;
+  else Stat->M2 += Square;
+}
+
+
+
+/*
+ *  add values of probed component to statistics
+ *
+ *  requires:
+ *  - Stats: array of statistics (NUM_STATS)
+ */
+
+void Stats_Update(Stat_Type *Stats)
+{
+  Capacitor_Type    *Cap;               /* pointer to capacitor */
+  uint8_t           n;                  /* counter */
+
+  switch (Check.Found)
+  {
+    case COMP_RESISTOR:
+      if (Check.Resistors == 1)         /* single resistor */
+      {
+        Stats_Add(&Stats[0], Stat_R_str, LCD_CHAR_OMEGA,
+          Resistors[0].Value, Resistors[0].Scale);
+
+        #ifdef SW_INDUCTOR
+        if (MeasureInductor(&Resistors[0]) == 1)
+        {
+          Stats_Add(&Stats[1], Stat_L_str, 'H',
+            Inductor.Value, Inductor.Scale);
+        }
+        #endif
+      }
+      break;
+
+    case COMP_CAPACITOR:
+      /* take largest capacitance */
+      Cap = &Caps[0];
+      n = 1;
+      while (n < 3)
+      {
+        if (CmpValue(Caps[n].Value, Caps[n].Scale, Cap->Value, Cap->Scale) == 1)
+        {
+          Cap = &Caps[n];
+        }
+        n++;
+      }
+
+      Stats_Add(&Stats[0], Stat_C_str, 'F', Cap->Value, Cap->Scale);
+      break;
+
+    case COMP_DIODE:
+      if (Check.Diodes == 1)            /* single diode */
+      {
+        Stats_Add(&Stats[0], Vf_str, 'V', Diodes[0].V_f, -3);
+      }
+      break;
+
+    case COMP_BJT:
+      Stats_Add(&Stats[0], h_FE_str, 0, Semi.F_1, 0);
+      break;
+
+    case COMP_FET:
+      if (Semi.U_1 > 0)                 /* R_DS measured */
+      {
+        Stats_Add(&Stats[1], R_DS_str, LCD_CHAR_OMEGA, Semi.U_1, -2);
+      }
+      /* fall through */
+
+    case COMP_IGBT:
+      /* V_th is negative for p-channel */
+      Stats_Add(&Stats[0], Vth_str, 'V',
+        (Semi.U_2 < 0) ? -Semi.U_2 : Semi.U_2, -3);
+      break;
+
+    case COMP_THYRISTOR:
+    case COMP_TRIAC:
+      Stats_Add(&Stats[0], V_GT_str, 'V', Semi.U_1, -3);
+      break;
+  }
+}
+
+
+
+/*
+ *  probe component repeatedly and collect statistics
+ *  - stops when the component type changes
+ *
+ *  requires:
+ *  - Stats: array of statistics (NUM_STATS)
+ *  - Mode:
+ *    STATS_LCD     show progress on LCD
+ *    STATS_SERIAL  no progress output
+ */
+
+void Stats_Run(Stat_Type *Stats, uint8_t Mode)
+{
+  uint8_t           Run = 0;            /* run counter */
+  uint8_t           Type = COMP_NONE;   /* component type of first run */
+  uint8_t           n;                  /* counter */
+
+  /* reset statistics */
+  n = 0;
+  while (n < NUM_STATS)
+  {
+    Stats[n].Count = 0;
+    n++;
+  }
+
+  while (Run < STATS_RUNS)
+  {
+    Run++;
+
+    if (Mode == STATS_LCD)              /* show progress */
+    {
+      LCD_ClearLine2();
+      Display_Value(Run, 0, 0);
+    }
+
+    if (ResetProbing() == 0)            /* discharge failed */
+    {
+      break;
+    }
+
+    /* full probing cycle */
+    CheckProbes(PROBE_1, PROBE_2, PROBE_3);
+    CheckProbes(PROBE_2, PROBE_1, PROBE_3);
+    CheckProbes(PROBE_1, PROBE_3, PROBE_2);
+    CheckProbes(PROBE_3, PROBE_1, PROBE_2);
+    CheckProbes(PROBE_2, PROBE_3, PROBE_1);
+    CheckProbes(PROBE_3, PROBE_2, PROBE_1);
+    CheckAlternatives();
+
+    if ((Check.Found == COMP_NONE) ||
+        (Check.Found == COMP_RESISTOR))
+    {
+      MeasureCap(PROBE_3, PROBE_1, 0);
+      MeasureCap(PROBE_3, PROBE_2, 1);
+      MeasureCap(PROBE_2, PROBE_1, 2);
+    }
+
+    /* component has to stay the same */
+    if (Run == 1) Type = Check.Found;
+
+    if ((Check.Found < COMP_RESISTOR) || (Check.Found != Type))
+    {
+      /* discard statistics */
+      n = 0;
+      while (n < NUM_STATS)
+      {
+        Stats[n].Count = 0;
+        n++;
+      }
+
+      break;
+    }
+
+    Stats_Update(Stats);
+  }
+}
+
+
+
+/*
+ *  display statistics
+ *  - name, number of samples, mean, minimum, maximum and
+ *    standard deviation
+ *
+ *  requires:
+ *  - Stat: pointer to statistics
+ *  - Mode:
+ *    STATS_LCD     one value per line with label
+ *    STATS_SERIAL  single line, values separated by spaces
+ */
+
+void Stats_Show(Stat_Type *Stat, uint8_t Mode)
+{
+  uint32_t          Value;              /* value */
+  uint8_t           n;                  /* counter */
+
+  Display_EEString_Space(Stat->Name);   /* display name */
+  Display_Value(Stat->Count, 0, 0);     /* display number of samples */
+
+  n = 0;
+  while (n < 4)
+  {
+    if (Mode == STATS_LCD)
+    {
+      if (n == 0) Display_NL_EEString_Space(Stat_Avg_str);
+      else if (n == 1) Display_NL_EEString_Space(Stat_Min_str);
+      else if (n == 2) Display_NL_EEString_Space(Stat_Max_str);
+      else Display_NL_EEString_Space(Stat_SD_str);
+    }
+    else
+    {
+      Display_Space();
+    }
+
+    if (n == 0)                         /* mean */
+    {
+      Value = ((uint32_t)Stat->Mean * 10) / 16;
+      Display_Value(Value, Stat->Scale - 1, Stat->Unit);
+    }
+    else if (n == 1)                    /* minimum */
+    {
+      Display_Value(Stat->Min, Stat->Scale, Stat->Unit);
+    }
+    else if (n == 2)                    /* maximum */
+    {
+      Display_Value(Stat->Max, Stat->Scale, Stat->Unit);
+    }
+    else                                /* standard deviation */
+    {
+      Value = 0;
+      if (Stat->Count > 1)
+      {
+        Value = SquareRoot(Stat->M2 / (Stat->Count - 1));
+        Value = (Value * 10) / 16;
+      }
+      Display_Value(Value, Stat->Scale - 1, Stat->Unit);
+    }
+
+    n++;
+  }
+}
+
+
+
+/*
+ *  statistics of repeated measurements
+ *  - probes the connected component STATS_RUNS times and shows
+ *    the spread of the main values
+ */
+
+void Stats_Tool(void)
+{
+  uint8_t           Flag = 1;           /* loop control */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           n;                  /* counter */
+  Stat_Type         Stats[NUM_STATS];   /* statistics */
+
+  while (Flag)
+  {
+    /* display info */
+    LCD_Clear();
+    Display_EEString(Statistics_str);   /* display: Statistics */
+    Display_NL_EEString(Probing_str);   /* display: probing... */
+    MilliSleep(500);
+
+    Stats_Run(Stats, STATS_LCD);        /* collect values */
+
+    /* show results */
+    LCD_Clear();
+    Display_EEString(Statistics_str);   /* display: Statistics */
+    UI.LineMode = LINE_KEEP | LINE_KEY;
+    Test = 0;
+    n = 0;
+    while (n < NUM_STATS)
+    {
+      if (Stats[n].Count > 0)           /* got values */
+      {
+        Display_NextLine();
+        Stats_Show(&Stats[n], STATS_LCD);
+        Test = 1;
+      }
+      n++;
+    }
+
+    if (Test == 0)                      /* no values */
+    {
+      Display_NL_EEString(Failed1_str);      /* display: no component */
+    }
+    UI.LineMode = LINE_STD;
+
+    /* short key press: run again / two short key presses: exit */
+    Test = TestKey(0, CURSOR_BLINK);
+    if (Test == KEY_SHORT)
+    {
+      MilliSleep(50);                   /* debounce button a little bit longer */
+      Test = TestKey(200, CURSOR_NONE); /* check for second key press */
+      if (Test > KEY_TIMEOUT)           /* second key press */
+      {
+        Flag = 0;                       /* end loop */
+      }
+    }
+  }
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   raw ADC stream
+ * ************************************************************************ */
+
+
+#ifdef SW_ADC_STREAM
+
+/*
+ *  ISR for ADC conversion complete
+ *  - stores samples of the free-running ADC in the half of the double
+ *    buffer being filled, the other half is sent meanwhile
+ *  - when both halves are waiting for the sender the next block of
+ *    samples is skipped, but it takes a sequence number anyway, so the
+ *    host is able to detect the gap
+ */
+
+ISR(ADC_vect, ISR_BLOCK)
+{
+  uint16_t          Value;    /* ADC value */
+
+  /*
+   *  hints:
+   *  - the ADIF interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  if (StreamMode & STREAM_8BIT)    /* fast mode */
+  {
+    Value = ADCH;                  /* upper 8 bits (left adjusted) */
+  }
+  else                             /* normal mode */
+  {
+    Value = ADCW;                  /* 10 bits */
+  }
+
+  if (StreamPos == 0)              /* start of block */
+  {
+    /* skip block if half isn't sent yet */
+    StreamSkip = StreamFull & (1 << StreamHalf);
+  }
+
+  if (! StreamSkip)                /* store sample */
+  {
+    StreamBuffer[StreamHalf][StreamPos] = Value;
+  }
+
+  StreamPos++;                     /* next sample */
+
+  if (StreamPos >= STREAM_SAMPLES) /* end of block */
+  {
+    StreamPos = 0;
+
+    if (! StreamSkip)              /* half filled */
+    {
+      StreamSeq[StreamHalf] = StreamCount;       /* sequence number */
+      StreamFull |= (1 << StreamHalf);           /* ready to send */
+      StreamHalf ^= 1;                           /* switch halves */
+    }
+
+    StreamCount++;                 /* next sequence number */
+  }
+}
+
+
+
+/*
+ *  send byte of ADC stream frame
+ *  - updates CRC (same as binary telemetry)
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Stream_Byte(uint8_t Byte)
+{
+  StreamCRC = _crc_xmodem_update(StreamCRC, Byte);   /* update CRC */
+  Serial_WriteByte(Byte);                            /* send byte */
+}
+
+
+
+/*
+ *  send half of double buffer as frame
+ *  - frame:
+ *    sync (0xAA), payload size, type, payload, CRC-16 (LSB first)
+ *    CRC covers payload size, type and payload
+ *  - payload:
+ *    sequence number, mode (STREAM_8BIT and probe), samples
+ *  - 10 bit samples: blocks of 4 samples packed into 5 bytes,
+ *    lower 8 bits of each sample followed by the upper 2 bits of
+ *    all 4 samples (first sample in bits 0-1)
+ *  - 8 bit samples: 1 byte per sample
+ *
+ *  requires:
+ *  - Half: half of double buffer (0 or 1)
+ */
+
+void Stream_Frame(uint8_t Half)
+{
+  uint16_t          *Sample;       /* pointer to sample */
+  uint8_t           n;             /* counter */
+  uint8_t           Bits;          /* upper bits of 4 samples */
+
+  Sample = &StreamBuffer[Half][0];
+
+  /* header */
+  Serial_WriteByte(TELE_SYNC);     /* start of frame */
+  StreamCRC = 0xFFFF;              /* start value of CRC */
+  if (StreamMode & STREAM_8BIT)    /* payload size */
+  {
+    Stream_Byte(TELE_STREAM_SIZE_8);
+  }
+  else
+  {
+    Stream_Byte(TELE_STREAM_SIZE);
+  }
+  Stream_Byte(TELE_STREAM);        /* frame type */
+  Stream_Byte(StreamSeq[Half]);    /* sequence number */
+  Stream_Byte(StreamMode);         /* mode and probe */
+
+  /* samples */
+  n = 0;
+  Bits = 0;
+  while (n < STREAM_SAMPLES)
+  {
+    Stream_Byte((uint8_t)*Sample);      /* lower 8 bits */
+
+    if (! (StreamMode & STREAM_8BIT))   /* 10 bit samples */
+    {
+      /* collect upper 2 bits */
+      Bits >>= 2;
+      Bits |= (uint8_t)(*Sample >> 2) & 0b11000000;
+
+      if ((n & 0b00000011) == 3)        /* 4th sample */
+      {
+        Stream_Byte(Bits);              /* send upper bits */
+      }
+    }
+
+    Sample++;                           /* next sample */
+    n++;
+  }
+
+  /* CRC (LSB first), not covered by itself */
+  n = (uint8_t)(StreamCRC >> 8);   /* save MSB */
+  Serial_WriteByte((uint8_t)StreamCRC);
+  Serial_WriteByte(n);
+}
+
+
+
+/*
+ *  raw ADC stream
+ *  - samples a probe in free-running mode and sends the raw ADC values
+ *    via TTL serial
+ *  - probe, resolution and sample rate are selected by menus
+ *  - 10 bit mode is limited to the standard ADC clock (ADC_FREQ),
+ *    fast mode (8 bit) allows higher rates at a lower resolution
+ *  - a key press ends the stream
+ */
+
+void ADC_Stream(void)
+{
+  uint8_t           Probe;              /* probe (0-2) */
+  uint8_t           Mode = 0;           /* mode flags */
+  uint8_t           Rate;               /* ID of sample rate */
+  uint8_t           Items;              /* number of menu items */
+  uint8_t           Half = 0;           /* half to send */
+  uint8_t           Flag = 1;           /* loop control */
+  void              *ProbeItem[3];      /* menu: probes */
+  void              *ModeItem[2];       /* menu: resolution */
+
+  /* set up menus */
+  ProbeItem[0] = (void *)Stream_TP1_str;
+  ProbeItem[1] = (void *)Stream_TP2_str;
+  ProbeItem[2] = (void *)Stream_TP3_str;
+  ModeItem[0] = (void *)Stream_10bit_str;
+  ModeItem[1] = (void *)Stream_8bit_str;
+
+  /* select probe */
+  LCD_Clear();
+  Display_EEString(ADC_Stream_str);     /* display: ADC Stream */
+  Probe = MenuTool(3, 1, ProbeItem, NULL);
+
+  /* select resolution */
+  LCD_Clear();
+  Display_EEString(ADC_Stream_str);     /* display: ADC Stream */
+  if (MenuTool(2, 1, ModeItem, NULL) == 1)   /* 8 bit */
+  {
+    Mode = STREAM_8BIT;
+  }
+
+  /* select sample rate (prescaler 128 >> Rate) */
+  Items = NUM_STREAM_RATES;
+  if (! (Mode & STREAM_8BIT))      /* 10 bit */
+  {
+    /* limit ADC clock to ADC_FREQ */
+    while ((128 >> (Items - 1)) < (CPU_FREQ / ADC_FREQ)) Items--;
+  }
+  LCD_Clear();
+  Display_EEString(ADC_Stream_str);     /* display: ADC Stream */
+  Rate = MenuTool(Items, 2, (void *)Stream_Rate_table, (unsigned char *)Hertz_str);
+
+  /* display settings */
+  LCD_Clear();
+  Display_EEString(ADC_Stream_str);     /* display: ADC Stream */
+  Display_NL_EEString_Space(ProbeItem[Probe]);    /* display probe */
+  Display_Value(eeprom_read_word(&Stream_Rate_table[Rate]), 0, 0);
+  Display_EEString(Hertz_str);          /* display: Hz */
+
+  /* set probes to HiZ */
+  R_DDR = 0;                       /* disable probe resistors */
+  R_PORT = 0;
+  ADC_DDR = 0;                     /* set ADC pins to HiZ */
+  ADC_PORT = 0;
+
+  /* reset double buffer */
+  StreamMode = Mode | Probe;
+  StreamHalf = 0;
+  StreamPos = 0;
+  StreamCount = 0;
+  StreamFull = 0;
+
+  /* start ADC in free-running mode */
+  if (Mode & STREAM_8BIT)          /* fast mode */
+  {
+    ADMUX = ADC_REF_VCC | (1 << ADLAR) | (TP1 + Probe);   /* left adjusted */
+  }
+  else                             /* normal mode */
+  {
+    ADMUX = ADC_REF_VCC | (TP1 + Probe);
+  }
+  ADCSRB = 0;                      /* trigger source: free running */
+  /* prescaler bits: 7 for 128, 6 for 64 and 5 for 32 */
+  ADCSRA = (1 << ADEN) | (1 << ADSC) | (1 << ADATE) | (1 << ADIF) | (1 << ADIE) | (7 - Rate);
+
+  while (Flag)
+  {
+    if (StreamFull & (1 << Half))  /* half ready */
+    {
+      Stream_Frame(Half);          /* send it */
+
+      cli();                       /* disable interrupts */
+      StreamFull &= ~(1 << Half);  /* free half */
+      sei();                       /* enable interrupts */
+
+      Half ^= 1;                   /* next half */
+    }
+
+    if (!(CONTROL_PIN & (1 << TEST_BUTTON)))   /* test button pressed */
+    {
+      Flag = 0;                    /* end loop */
+    }
+  }
+
+  /* stop ADC and restore default settings */
+  ADCSRA = (1 << ADEN) | (1 << ADIF) | ADC_CLOCK_DIV;
+  ADMUX = ADC_REF_VCC;
+
+  #ifdef SERIAL_TX_BUFFER
+  Serial_Flush();                  /* send remaining bytes */
+  #endif
+
+  /* wait until button is released */
+  while (!(CONTROL_PIN & (1 << TEST_BUTTON)));
+  MilliSleep(50);                  /* debounce button */
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   clean-up of local constants
  * ************************************************************************ */
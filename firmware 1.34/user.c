@@ -601,6 +601,10 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
     }
   }
 
+  #ifdef UI_TEXT_SHADOW
+  Shadow_Flush(SHADOW_DONE);  /* finish screen */
+  #endif
+
   if (Mode & (CURSOR_STEADY | CURSOR_BLINK))  /* cursor enabled */
   {
     LCD_Cursor(1);            /* enable cursor on display */
@@ -741,7 +745,8 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
        */
 
       #ifdef SERIAL_RW
-      if (Cfg.OP_Control & OP_RX_LOCKED)     /* buffer locked */
+      if ((Cfg.OP_Control & OP_RX_CMD) &&    /* remote commands enabled */
+          (RX_Lines || RX_Dropped))          /* and queued line */
       {
         /* we received a command via the serial interface */
         Key = KEY_COMMAND;         /* remote command */
@@ -1331,8 +1336,26 @@ uint8_t PresentMainMenu(void)
     #define ITEM_19      0
   #endif
 
-  #define MENU_ITEMS (ITEM_0 + ITEM_6 + ITEM_7 + ITEM_8 + ITEM_9 + ITEM_10 + ITEM_11 + ITEM_12 + ITEM_13 + ITEM_14 + ITEM_15 + ITEM_16 + ITEM_17 + ITEM_18 + ITEM_19)
-//  #define MENU_ITEMS     19             /* worst case */
+  #ifdef SW_SORTER
+    #define ITEM_20      1
+  #else
+    #define ITEM_20      0
+  #endif
+
+  #ifdef SW_STATISTICS
+    #define ITEM_21      1
+  #else
+    #define ITEM_21      0
+  #endif
+
+  #ifdef SW_ADC_STREAM
+    #define ITEM_22      1
+  #else
+    #define ITEM_22      0
+  #endif
+
+  #define MENU_ITEMS (ITEM_0 + ITEM_6 + ITEM_7 + ITEM_8 + ITEM_9 + ITEM_10 + ITEM_11 + ITEM_12 + ITEM_13 + ITEM_14 + ITEM_15 + ITEM_16 + ITEM_17 + ITEM_18 + ITEM_19 + ITEM_20 + ITEM_21 + ITEM_22)
+//  #define MENU_ITEMS     20             /* worst case */
 
   uint8_t           Item = 0;           /* item number */
   uint8_t           ID;                 /* ID of selected item */
@@ -1370,6 +1393,21 @@ uint8_t PresentMainMenu(void)
   MenuID[Item] = 19;
   Item++;
   #endif
+  #ifdef SW_SORTER
+  MenuItem[Item] = (void *)Sorter_str;       /* bin sorter */
+  MenuID[Item] = 20;
+  Item++;
+  #endif
+  #ifdef SW_STATISTICS
+  MenuItem[Item] = (void *)Statistics_str;   /* statistics */
+  MenuID[Item] = 21;
+  Item++;
+  #endif
+  #ifdef SW_ADC_STREAM
+  MenuItem[Item] = (void *)ADC_Stream_str;   /* raw ADC stream */
+  MenuID[Item] = 22;
+  Item++;
+  #endif
   #ifdef HW_FREQ_COUNTER
   MenuItem[Item] = (void *)FreqCounter_str;  /* frequency counter */
   MenuID[Item] = 10;
@@ -1586,6 +1624,24 @@ void MainMenu(void)
       Cap_Leakage();
       break;
     #endif
+
+    #ifdef SW_SORTER
+    case 20:             /* bin sorter */
+      Sort_Tool();
+      break;
+    #endif
+
+    #ifdef SW_STATISTICS
+    case 21:             /* statistics */
+      Stats_Tool();
+      break;
+    #endif
+
+    #ifdef SW_ADC_STREAM
+    case 22:             /* raw ADC stream */
+      ADC_Stream();
+      break;
+    #endif
   }
 
   /* display result */
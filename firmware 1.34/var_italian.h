@@ -112,6 +112,20 @@
     const unsigned char CapDischarge_str[] EEMEM = "Discharging";
   #endif
 
+  #ifdef SW_SORTER
+    const unsigned char Sorter_str[] EEMEM = "Bin Sorter";
+    const unsigned char SortFail_str[] EEMEM = "Fail";
+    const unsigned char SortRef_str[] EEMEM = "Ref";
+  #endif
+
+  #ifdef SW_STATISTICS
+    const unsigned char Statistics_str[] EEMEM = "Statistics";
+  #endif
+
+  #ifdef SW_ADC_STREAM
+    const unsigned char ADC_Stream_str[] EEMEM = "ADC Stream";
+  #endif
+
   #ifdef HW_TOUCH
     const unsigned char TouchSetup_str[] EEMEM = "Touch Setup";
   #endif
@@ -47,8 +47,15 @@
   /* buffers */
   char              OutBuffer[OUT_BUFFER_SIZE];   /* output buffer */
   #ifdef SERIAL_RW
-  char              RX_Buffer[RX_BUFFER_SIZE];    /* serial RX buffer */
-  uint8_t           RX_Pos = 0;                   /* position in buffer */
+  /* serial RX line queue */
+  char              RX_Buffer[RX_LINES][RX_BUFFER_SIZE];   /* lines */
+  uint8_t           RX_Pos = 0;              /* position in current line */
+  uint8_t           RX_State = 0;            /* state of current line */
+  uint8_t           RX_Head = 0;             /* oldest line in queue */
+  volatile uint8_t  RX_Lines = 0;            /* complete lines in queue */
+  uint8_t           RX_Overflow = 0;         /* overflow flags (bit per line) */
+  uint8_t           RX_Lost[RX_LINES];       /* lines lost after each line */
+  volatile uint8_t  RX_Dropped = 0;          /* lost lines to answer next */
     #ifdef SERIAL_BITBANG
     uint8_t         RX_Char;                 /* RX char (bit buffer) */
     uint8_t         RX_Bits;                 /* bit counter for RX char */
@@ -112,6 +119,11 @@
   const Touch_Type      NV_Touch EEMEM = {0, 0, 0, 0, 0};
   #endif
 
+  #ifdef SW_SORTER
+  /* bin sorter reference value */
+  const Sort_Type       NV_Sort EEMEM = {COMP_NONE, 0, 0, 0};
+  #endif
+
 
   /*
    *  constant strings (stored in EEPROM)
@@ -181,7 +193,7 @@
   #if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS)
     const unsigned char PWM_str[] EEMEM = "PWM";
   #endif
-  #if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT)
+  #if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT) || defined (SW_ADC_STREAM)
     const unsigned char Hertz_str[] EEMEM = "Hz";
   #endif
   #if defined (SW_IR_RECEIVER) || defined (HW_IR_RECEIVER)
@@ -228,6 +240,22 @@
   #ifdef SW_DS18B20
     const unsigned char DS18B20_str[] EEMEM = "DS18B20";
   #endif
+  #ifdef SW_STATISTICS
+    const unsigned char Stat_R_str[] EEMEM = "R";
+    const unsigned char Stat_C_str[] EEMEM = "C";
+    const unsigned char Stat_L_str[] EEMEM = "L";
+    const unsigned char Stat_Avg_str[] EEMEM = "avg";
+    const unsigned char Stat_Min_str[] EEMEM = "min";
+    const unsigned char Stat_Max_str[] EEMEM = "max";
+    const unsigned char Stat_SD_str[] EEMEM = "sd";
+  #endif
+  #ifdef SW_ADC_STREAM
+    const unsigned char Stream_TP1_str[] EEMEM = "TP1";
+    const unsigned char Stream_TP2_str[] EEMEM = "TP2";
+    const unsigned char Stream_TP3_str[] EEMEM = "TP3";
+    const unsigned char Stream_10bit_str[] EEMEM = "10 bit";
+    const unsigned char Stream_8bit_str[] EEMEM = "8 bit";
+  #endif
 
   /* component symbols */
   const unsigned char Cap_str[] EEMEM = {'-', LCD_CHAR_CAP, '-',0};
@@ -245,81 +273,6 @@
     const unsigned char Cmd_D_fb_str[] EEMEM = "D_FB";
     const unsigned char Cmd_BJT_str[] EEMEM = "BJT";
     const unsigned char Cmd_SYM_str[] EEMEM = "SYM";
-
-    /* commands */
-    const unsigned char Cmd_VER_str[] EEMEM = "VER";
-    const unsigned char Cmd_PROBE_str[] EEMEM = "PROBE";
-    const unsigned char Cmd_OFF_str[] EEMEM = "OFF";
-    const unsigned char Cmd_COMP_str[] EEMEM = "COMP";
-    const unsigned char Cmd_MSG_str[] EEMEM = "MSG";
-    const unsigned char Cmd_QTY_str[] EEMEM = "QTY";
-    const unsigned char Cmd_NEXT_str[] EEMEM = "NEXT";
-    const unsigned char Cmd_TYPE_str[] EEMEM = "TYPE";
-    const unsigned char Cmd_HINT_str[] EEMEM = "HINT";
-    const unsigned char Cmd_PIN_str[] EEMEM = "PIN";
-    const unsigned char Cmd_R_str[] EEMEM = "R";
-    const unsigned char Cmd_C_str[] EEMEM = "C";
-    #ifdef SW_INDUCTOR
-    const unsigned char Cmd_L_str[] EEMEM = "L";
-    #endif
-    #if defined (SW_ESR) || defined (SW_OLD_ESR)
-    const unsigned char Cmd_ESR_str[] EEMEM = "ESR";
-    #endif
-    const unsigned char Cmd_V_F_str[] EEMEM = "V_F";
-    const unsigned char Cmd_V_F2_str[] EEMEM = "V_F2";
-    const unsigned char Cmd_C_D_str[] EEMEM = "C_D";
-    const unsigned char Cmd_R_BE_str[] EEMEM = "R_BE";
-    const unsigned char Cmd_h_FE_str[] EEMEM = "h_FE";
-    const unsigned char Cmd_V_BE_str[] EEMEM = "V_BE";
-    const unsigned char Cmd_I_CEO_str[] EEMEM = "I_CEO";
-    const unsigned char Cmd_V_TH_str[] EEMEM = "V_th";
-    const unsigned char Cmd_C_GS_str[] EEMEM = "C_GS";
-    const unsigned char Cmd_R_DS_str[] EEMEM = "R_DS";
-    const unsigned char Cmd_I_DSS_str[] EEMEM = "I_DSS";
-    const unsigned char Cmd_C_GE_str[] EEMEM = "C_GE";
-    const unsigned char Cmd_V_T_str[] EEMEM = "V_T";
-
-    /* command reference table */
-    const Cmd_Type Cmd_Table[] EEMEM = {
-      {CMD_VER, Cmd_VER_str},
-      {CMD_PROBE, Cmd_PROBE_str},
-      {CMD_OFF, Cmd_OFF_str},
-      {CMD_COMP, Cmd_COMP_str},
-      {CMD_MSG, Cmd_MSG_str},
-      {CMD_QTY, Cmd_QTY_str},
-      {CMD_NEXT, Cmd_NEXT_str},
-      {CMD_TYPE, Cmd_TYPE_str},
-      {CMD_HINT, Cmd_HINT_str},
-      {CMD_PIN, Cmd_PIN_str},
-      {CMD_R, Cmd_R_str},
-      {CMD_C, Cmd_C_str},
-      #ifdef SW_INDUCTOR
-      {CMD_L, Cmd_L_str},
-      #endif
-      #if defined (SW_ESR) || defined (SW_OLD_ESR)
-      {CMD_ESR, Cmd_ESR_str},
-      #endif
-      {CMD_I_L, I_leak_str},
-      {CMD_V_F, Cmd_V_F_str},
-      {CMD_V_F2, Cmd_V_F2_str},
-      {CMD_C_D, Cmd_C_D_str},
-      {CMD_I_R, I_R_str},
-      {CMD_R_BE, Cmd_R_BE_str},
-      {CMD_H_FE, Cmd_h_FE_str},
-      {CMD_V_BE, Cmd_V_BE_str},
-      {CMD_I_CEO, Cmd_I_CEO_str},
-      {CMD_V_TH, Cmd_V_TH_str},
-      {CMD_C_GS, Cmd_C_GS_str},
-      {CMD_R_DS, Cmd_R_DS_str},
-      {CMD_I_DSS, Cmd_I_DSS_str},
-      {CMD_C_GE, Cmd_C_GE_str},
-      {CMD_V_GT, V_GT_str},
-      {CMD_V_T, Cmd_V_T_str},
-      #ifdef SW_UJT
-      {CMD_R_BB, R_BB_str},
-      #endif
-      {0, 0}
-    };
   #endif
 
 
@@ -344,6 +297,16 @@
   const uint16_t PWM_Freq_table[NUM_PWM_FREQ] EEMEM = {100, 250, 500, 1000, 2500, 5000, 10000, 25000};
   #endif
 
+  #ifdef SW_SORTER
+  /* bin sorter: tolerance limits (in 0.1%) */
+  const uint16_t Sort_Bin_table[NUM_SORT_BINS] EEMEM = {10, 20, 50, 100};
+  #endif
+
+  #ifdef SW_ADC_STREAM
+  /* ADC stream: sample rates for ADC prescaler 128, 64 and 32 (13 ADC clocks per sample) */
+  const uint16_t Stream_Rate_table[NUM_STREAM_RATES] EEMEM = {CPU_FREQ / 1664, CPU_FREQ / 832, CPU_FREQ / 416};
+  #endif
+
   #ifdef SW_INDUCTOR
   /* ratio based factors for inductors */
   /* ratio:                                             200   225   250   275   300   325   350   375   400   425   450   475   500   525   550   575   600   625  650  675  700  725  750  775  800  825  850  875  900  925  950  975 */
@@ -394,8 +357,15 @@
   /* buffers */
   extern char            OutBuffer[];        /* output buffer */
   #ifdef SERIAL_RW
-  extern char            RX_Buffer[];        /* serial RX buffer */
-  extern uint8_t         RX_Pos;             /* position in buffer */
+  /* serial RX line queue */
+  extern char            RX_Buffer[][RX_BUFFER_SIZE];  /* lines */
+  extern uint8_t         RX_Pos;             /* position in current line */
+  extern uint8_t         RX_State;           /* state of current line */
+  extern uint8_t         RX_Head;            /* oldest line in queue */
+  extern volatile uint8_t RX_Lines;          /* complete lines in queue */
+  extern uint8_t         RX_Overflow;        /* overflow flags (bit per line) */
+  extern uint8_t         RX_Lost[];          /* lines lost after each line */
+  extern volatile uint8_t RX_Dropped;        /* lost lines to answer next */
     #ifdef SERIAL_BITBANG
     extern uint8_t       RX_Char;            /* RX char (bit buffer) */
     extern uint8_t       RX_Bits;            /* bit counter for RX char */
@@ -458,6 +428,11 @@
   extern const Touch_Type     NV_Touch;
   #endif
 
+  #ifdef SW_SORTER
+  /* bin sorter reference value */
+  extern const Sort_Type      NV_Sort;
+  #endif
+
 
   /*
    *  constant strings (stored in EEPROM)
@@ -465,6 +440,7 @@
 
   extern const unsigned char Version_str[];
   extern const unsigned char Probing_str[];
+  extern const unsigned char Failed1_str[];
   extern const unsigned char Done_str[];
   extern const unsigned char Select_str[];
   extern const unsigned char Selftest_str[];
@@ -492,9 +468,11 @@
   extern const unsigned char PNP_str[];
   extern const unsigned char h_FE_str[];
   extern const unsigned char V_BE_str[];
+  extern const unsigned char V_GT_str[];
   extern const unsigned char I_CEO_str[];
   extern const unsigned char Vf_str[];
   extern const unsigned char Vth_str[];
+  extern const unsigned char R_DS_str[];
   extern const unsigned char URef_str[];
   extern const unsigned char RhLow_str[];
   extern const unsigned char RhHigh_str[];
@@ -523,7 +501,7 @@
   #if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS)
     extern const unsigned char PWM_str[];    
   #endif
-  #if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT)
+  #if defined (SW_PWM_SIMPLE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT) || defined (SW_ADC_STREAM)
     extern const unsigned char Hertz_str[];
   #endif
   #ifdef SW_SQUAREWAVE
@@ -609,6 +587,24 @@
   #ifdef SW_DS18B20
     extern const unsigned char DS18B20_str[];
   #endif
+  #ifdef SW_STATISTICS
+    extern const unsigned char Statistics_str[];
+    extern const unsigned char Stat_R_str[];
+    extern const unsigned char Stat_C_str[];
+    extern const unsigned char Stat_L_str[];
+    extern const unsigned char Stat_Avg_str[];
+    extern const unsigned char Stat_Min_str[];
+    extern const unsigned char Stat_Max_str[];
+    extern const unsigned char Stat_SD_str[];
+  #endif
+  #ifdef SW_ADC_STREAM
+    extern const unsigned char ADC_Stream_str[];
+    extern const unsigned char Stream_TP1_str[];
+    extern const unsigned char Stream_TP2_str[];
+    extern const unsigned char Stream_TP3_str[];
+    extern const unsigned char Stream_10bit_str[];
+    extern const unsigned char Stream_8bit_str[];
+  #endif
   #ifdef SW_CAP_LEAKAGE
     extern const unsigned char CapLeak_str[];
     extern const unsigned char CapCharge_str[];
@@ -616,6 +612,11 @@
     extern const unsigned char CapLow_str[];
     extern const unsigned char CapDischarge_str[];
   #endif
+  #ifdef SW_SORTER
+    extern const unsigned char Sorter_str[];
+    extern const unsigned char SortFail_str[];
+    extern const unsigned char SortRef_str[];
+  #endif
 
 
   /* remote commands */
@@ -628,42 +629,6 @@
     extern const unsigned char Cmd_D_fb_str[];
     extern const unsigned char Cmd_BJT_str[];
     extern const unsigned char Cmd_SYM_str[];
-
-    /* commands */
-    extern const unsigned char Cmd_VER_str[];
-    extern const unsigned char Cmd_PROBE_str[];
-    extern const unsigned char Cmd_OFF_str[];
-    extern const unsigned char Cmd_COMP_str[];
-    extern const unsigned char Cmd_MSG_str[];
-    extern const unsigned char Cmd_QTY_str[];
-    extern const unsigned char Cmd_NEXT_str[];
-    extern const unsigned char Cmd_TYPE_str[];
-    extern const unsigned char Cmd_HINT_str[];
-    extern const unsigned char Cmd_PIN_str[];
-    extern const unsigned char Cmd_R_str[];
-    extern const unsigned char Cmd_C_str[];
-    #ifdef SW_INDUCTOR
-    extern const unsigned char Cmd_L_str[];
-    #endif
-    #if defined (SW_ESR) || defined (SW_OLD_ESR)
-    extern const unsigned char Cmd_ESR_str[];
-    #endif
-    extern const unsigned char Cmd_V_F_str[];
-    extern const unsigned char Cmd_V_F2_str[];
-    extern const unsigned char Cmd_C_D_str[];
-    extern const unsigned char Cmd_R_BE_str[];
-    extern const unsigned char Cmd_h_FE_str[];
-    extern const unsigned char Cmd_V_BE_str[];
-    extern const unsigned char Cmd_I_CEO_str[];
-    extern const unsigned char Cmd_V_TH_str[];
-    extern const unsigned char Cmd_C_GS_str[];
-    extern const unsigned char Cmd_R_DS_str[];
-    extern const unsigned char Cmd_I_DSS_str[];
-    extern const unsigned char Cmd_C_GE_str[];
-    extern const unsigned char Cmd_V_T_str[];
-
-    /* command reference table */
-    extern const Cmd_Type Cmd_Table[];
   #endif
 
 
@@ -686,6 +651,16 @@
   extern const uint16_t PWM_Freq_table[];
   #endif
 
+  #ifdef SW_SORTER
+  /* bin sorter: tolerance limits */
+  extern const uint16_t Sort_Bin_table[];
+  #endif
+
+  #ifdef SW_ADC_STREAM
+  /* ADC stream: sample rates */
+  extern const uint16_t Stream_Rate_table[];
+  #endif
+
   #ifdef SW_INDUCTOR
   /* voltage based factors for inductors */
   extern const uint16_t Inductor_table[];